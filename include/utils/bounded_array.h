@@ -10,6 +10,14 @@
 #include <stdexcept>
 #include <iterator>
 #include <algorithm>
+#include <ranges>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
+
+#include "exceptions.h"
+#include "expected.h"
 
 namespace O
 {
@@ -18,10 +26,34 @@ namespace O
 	 * 	      This class provides a `std::vector`-like interface but stores all elements in a preallocated, statically-sized buffer. 
 	 *        Elements are constructed in-place and destroyed manually. 
 	 *        Attempts to exceed capacity or access out-of-range elements trigger a simple typed exception.
+	 *        The `Try_*` members report the same conditions through `O::Expected` instead and are usable when exceptions are disabled (see exceptions.h).
+	 *        Members are constexpr, so tables can be built at compile time (Try_At() and Try_Emplace_Back() return a niche-packed Expected, see O_UTILS_CONSTEXPR_NICHE).
 	 * 
 	 * @tparam T Type of stored elements.
 	 * @tparam N Maximum number of elements the container can hold.
+	 * @tparam Align Alignment of the element buffer, a power of two not smaller than alignof(T) (e.g. 32 for AVX, 64 for AVX-512 / a cache line).
+	 *         When larger than the element size, the capacity is rounded up to a whole number of Align-byte registers.
+	 */
+
+
+	/**
+	 * @brief Element types whose storage can be copied as raw bytes.
+	 *        When T satisfies this, Bounded_Vector defaults all its special members and becomes trivially copyable itself.
+	 */
+	template<typename T>
+	concept Trivially_Copyable_Element = std::is_trivially_copyable_v<T>;
+
+
+	/**
+	 * @brief Smallest unsigned integer type able to count up to N.
+	 *        Used for the size field of bounded containers so that small ones pack densely in arrays.
 	 */
+	template<std::size_t N>
+	using Bounded_Size_t =
+		std::conditional_t<(N <= std::numeric_limits<std::uint8_t>::max()), std::uint8_t,
+		std::conditional_t<(N <= std::numeric_limits<std::uint16_t>::max()), std::uint16_t,
+		std::conditional_t<(N <= std::numeric_limits<std::uint32_t>::max()), std::uint32_t,
+		std::size_t>>>;
 
 
 	enum class Bounded_Vector_Exception
@@ -29,11 +61,34 @@ namespace O
 		NO_ERROR = 0,
 		OUT_OF_RANGE,
 		NO_MORE_ELEMENT_TO_POP,
-		NO_MORE_PLACE_TO_EMPLACE
+		NO_MORE_PLACE_TO_EMPLACE,
+		KEY_NOT_FOUND
+	};
+
+
+	/**
+	 * @brief Uninitialized slots for up to CAPACITY objects of T, never constructed nor destroyed by the storage itself:
+	 *        its owner tracks which slots are alive. Element buffer of Bounded_Vector and inline buffer of Small_Vector.
+	 */
+	template<typename T, std::size_t CAPACITY>
+	union Bounded_Storage
+	{
+		T elements[CAPACITY];
+		constexpr Bounded_Storage() noexcept;
+		~Bounded_Storage() noexcept requires std::is_trivially_destructible_v<T> = default;
+		constexpr ~Bounded_Storage() noexcept {}
+	};
+
+	/// No slot at all: a zero-size array is ill-formed, the element pointer is null
+	template<typename T>
+	union Bounded_Storage<T, 0>
+	{
+		static constexpr T* elements = nullptr;
 	};
 
 
-	template<typename T, std::size_t N>
+	template<typename T, std::size_t N, std::size_t Align = alignof(T)>
+	requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
 	class Bounded_Vector 
 	{
 	public:
@@ -42,18 +97,24 @@ namespace O
 		 *        Only contains a `Type` discriminant; users may inspect the `type` field to determine the cause (out-of-range access, push on full container, pop on empty container).
 		 */
 
+	public:
+		static constexpr std::size_t ALIGNMENT = Align;                              ///< Alignment of Data()
+		static constexpr std::size_t LANES = Align / std::gcd(Align, sizeof(T));     ///< Smallest element count spanning a whole number of Align-byte registers
+		static constexpr std::size_t CAPACITY = (N + LANES - 1) / LANES * LANES;     ///< N rounded up to a multiple of LANES
+
 	private:
-		// storage: uninitialized, properly aligned memory for up to N objects of T
-		using storage_t = std::aligned_storage_t<sizeof(T), alignof(T)>;
-		std::array<storage_t, N> m_buffer; ///< Full stdarray buffer
-		std::size_t m_size = 0;            ///< Effective size of the bounded buffer
+		// storage: Align-aligned slots for up to CAPACITY objects of T, only the first m_size are alive
+		alignas(Align) Bounded_Storage<T, CAPACITY> m_buffer;  ///< Element slots
+		Bounded_Size_t<CAPACITY> m_size = 0;  ///< Effective size of the bounded buffer, as narrow as CAPACITY allows
 
 		/** @name Internal helpers
-		 *  @brief Raw pointer accessors into the internal buffer.
-		 *         These functions convert the raw storage slot into a typed pointer.
+		 *  @brief Pointer accessors into the internal buffer, and element destruction.
 		 *  @{ */
-		T* Ptr_At(std::size_t i) noexcept;
-		const T* Ptr_At(std::size_t i) const noexcept;
+		constexpr T* Ptr_At(std::size_t i) noexcept;
+		constexpr const T* Ptr_At(std::size_t i) const noexcept;
+		static constexpr void Destroy(T* element) noexcept;
+		constexpr void Truncate(std::size_t count) noexcept; ///< destroys the elements from count on, when count < Size()
+		static constexpr bool Bitwise_Relocation() noexcept; ///< elements may be moved around with memcpy / memmove
 		/** @} */
 
 	public:
@@ -65,58 +126,113 @@ namespace O
 		 *  - Move operations move-construct elements and leave the moved-from
 		 *    container empty.
 		 *  - The destructor destroys all live elements.
+		 *
+		 *  When T is trivially copyable every special member is defaulted instead: the container is then
+		 *  trivially copyable too (memcpy-able, passed in registers) and a moved-from container keeps its elements.
+		 *  Note that a defaulted copy moves the whole N-slot buffer, not only the Size() live elements.
 		 *  @{ */
 		constexpr Bounded_Vector() noexcept = default;
-		~Bounded_Vector() noexcept;
-		Bounded_Vector(const Bounded_Vector& other);
-		Bounded_Vector(Bounded_Vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value);
-		Bounded_Vector& operator=(const Bounded_Vector& other);
-		Bounded_Vector& operator=(Bounded_Vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value);
+		constexpr ~Bounded_Vector() noexcept requires Trivially_Copyable_Element<T> = default;
+		constexpr ~Bounded_Vector() noexcept;
+		constexpr Bounded_Vector(const Bounded_Vector& other) requires Trivially_Copyable_Element<T> = default;
+		constexpr Bounded_Vector(const Bounded_Vector& other);
+		constexpr Bounded_Vector(Bounded_Vector&& other) noexcept requires Trivially_Copyable_Element<T> = default;
+		constexpr Bounded_Vector(Bounded_Vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value);
+		constexpr Bounded_Vector& operator=(const Bounded_Vector& other) requires Trivially_Copyable_Element<T> = default;
+		constexpr Bounded_Vector& operator=(const Bounded_Vector& other);
+		constexpr Bounded_Vector& operator=(Bounded_Vector&& other) noexcept requires Trivially_Copyable_Element<T> = default;
+		constexpr Bounded_Vector& operator=(Bounded_Vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value);
 		template<typename... Args>
 		requires (sizeof...(Args) <= N) && (std::constructible_from<T, Args> && ...)
 		explicit constexpr Bounded_Vector(Args&&... args);
 		/** @} */
 
 		/** @name Capacity / state
-		 *  @brief Query capacity and size. Capacity() is constexpr and always equals N.
+		 *  @brief Query capacity and size. Capacity() is constexpr and always equals CAPACITY (N unless Align rounds it up).
+		 *
+		 *  Padded_Size() is Size() rounded up to LANES: a SIMD kernel may run aligned full-width loads over [Data(), Data() + Padded_Size()) without a scalar tail.
+		 *  The slots past Size() hold unspecified values until Fill_Padding() writes a neutral value (0 for a sum, +inf for a min...) into them.
 		 *  @{ */
 		constexpr std::size_t Capacity() const noexcept;
-		std::size_t Size() const noexcept;
-		bool Empty() const noexcept;
-		bool Full() const noexcept;
+		constexpr std::size_t Size() const noexcept;
+		constexpr bool Empty() const noexcept;
+		constexpr bool Full() const noexcept;
+		constexpr std::size_t Padded_Size() const noexcept requires Trivially_Copyable_Element<T>;
+		constexpr void Fill_Padding(const T& value) noexcept requires Trivially_Copyable_Element<T>;
 		/** @} */
 
 		/** @name Element access
 		 *  @brief Random-access accessors.
 		 *  @{ */
-		T& operator[](std::size_t i) noexcept;
-		const T& operator[](std::size_t i) const noexcept;
-		T& At(std::size_t i);
-		const T& At(std::size_t i) const;
-		T* Data() noexcept;
-		const T* Data() const noexcept;
+		constexpr T& operator[](std::size_t i) noexcept;
+		constexpr const T& operator[](std::size_t i) const noexcept;
+		constexpr T& At(std::size_t i);
+		constexpr const T& At(std::size_t i) const;
+		constexpr T* Data() noexcept;
+		constexpr const T* Data() const noexcept;
 		/** @} */
 
 		/** @name Modifiers
 		 *  @brief Mutating operations.
 		 *  @{ */
 		template<class... Args>
-		void Emplace_Back(Args&&... args);
-		void Push_Back(const T& v);
-		void Push_Back(T&& v);
-		void Pop_Back();
-		void Clear() noexcept;
+		constexpr void Emplace_Back(Args&&... args);
+		constexpr void Push_Back(const T& v);
+		constexpr void Push_Back(T&& v);
+		constexpr void Pop_Back();
+		constexpr void Clear() noexcept;
+		/** @} */
+
+		/** @name Non-throwing access / modifiers
+		 *  @brief Same operations as At(), Emplace_Back() and Pop_Back(), reporting failures as a `Bounded_Vector_Exception` error instead of throwing.
+		 *
+		 *  - Try_At() returns a pointer to the element.
+		 *  - Try_Emplace_Back() returns a pointer to the newly built element.
+		 *  - Try_Pop_Back() moves the last element out and returns it.
+		 *  @{ */
+		constexpr Expected<T*, Bounded_Vector_Exception> Try_At(std::size_t i) noexcept;
+		constexpr Expected<const T*, Bounded_Vector_Exception> Try_At(std::size_t i) const noexcept;
+		template<class... Args>
+		constexpr Expected<T*, Bounded_Vector_Exception> Try_Emplace_Back(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args&&...>);
+		constexpr Expected<T, Bounded_Vector_Exception> Try_Pop_Back() noexcept(std::is_nothrow_move_constructible_v<T>);
+		/** @} */
+
+		/** @name Bulk modifiers
+		 *  @brief Range operations doing a single capacity check and a single relocation of the tail.
+		 *         Trivially copyable elements are moved around with memcpy/memmove.
+		 *
+		 *  - Append() and Insert() throw NO_MORE_PLACE_TO_EMPLACE before touching anything when the range does not fit.
+		 *  - Emplace() builds a single element in front of pos.
+		 *  - Insert(), Emplace() and Erase() return a pointer to the first inserted element / the element following the erased ones.
+		 *  - The range given to Insert() must not alias this container.
+		 *  - Like std::vector, Insert(), Emplace() and Erase() shift elements by move-assignment: a throwing move leaves every element alive, in an unspecified order.
+		 *    Elements that cannot be move-assigned are relocated instead and must be nothrow move constructible.
+		 *  - Resize() value-initializes new elements, Resize_Uninitialized() leaves them as raw memory to be written through Data().
+		 *  @{ */
+		template<std::ranges::forward_range R>
+		requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+		constexpr void Append(R&& range);
+		template<std::ranges::forward_range R>
+		requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+		constexpr T* Insert(const T* pos, R&& range);
+		template<class... Args>
+		constexpr T* Emplace(const T* pos, Args&&... args);
+		constexpr T* Erase(const T* first, const T* last);
+		constexpr T* Erase(const T* pos);
+		constexpr void Resize(std::size_t count);
+		constexpr void Resize(std::size_t count, const T& value);
+		constexpr void Resize_Uninitialized(std::size_t count) requires std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>;
 		/** @} */
 
 		/** @name Iterators
 		 *  @brief Pointer-style contiguous iterators compatible with standard algorithms.
 		 *  @{ */
-		T* begin() noexcept;
-		T* end() noexcept;
-		const T* begin() const noexcept;
-		const T* end() const noexcept;
-		const T* cbegin() const noexcept;
-		const T* cend() const noexcept;
+		constexpr T* begin() noexcept;
+		constexpr T* end() noexcept;
+		constexpr const T* begin() const noexcept;
+		constexpr const T* end() const noexcept;
+		constexpr const T* cbegin() const noexcept;
+		constexpr const T* cend() const noexcept;
 		/** @} */
 	};
 }
@@ -2,73 +2,131 @@
 #define UTILS_BOUNDED_ARRAY_HPP
 
 #include "bounded_array.h"
+#include <algorithm>
 #include <utility>
 #include <cassert>
+#include <cstring>
+#include <memory>
 
 
 // helper implementations
-template<typename T, std::size_t N>
-T* O::Bounded_Vector<T, N>::Ptr_At(std::size_t i) noexcept
+template<typename T, std::size_t CAPACITY>
+constexpr O::Bounded_Storage<T, CAPACITY>::Bounded_Storage() noexcept
 {
-	return reinterpret_cast<T*>(&m_buffer[i]);
+	// a constant must be fully initialized: in constant evaluation the free slots of implicit-lifetime elements are value-initialized
+	if constexpr (std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>)
+		if (std::is_constant_evaluated())
+			for (std::size_t i = 0; i < CAPACITY; ++i)
+				std::construct_at(elements + i);
 }
 
-template<typename T, std::size_t N>
-const T* O::Bounded_Vector<T, N>::Ptr_At(std::size_t i) const noexcept
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr T* O::Bounded_Vector<T, N, Align>::Ptr_At(std::size_t i) noexcept
 {
-	return reinterpret_cast<const T*>(&m_buffer[i]);
+	return m_buffer.elements + i;
+}
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr const T* O::Bounded_Vector<T, N, Align>::Ptr_At(std::size_t i) const noexcept
+{
+	return m_buffer.elements + i;
+}
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr void O::Bounded_Vector<T, N, Align>::Destroy(T* element) noexcept
+{
+	// trivially destructible elements are left alive, so that a constant keeps every slot initialized
+	if constexpr (!std::is_trivially_destructible_v<T>)
+		std::destroy_at(element);
+}
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr void O::Bounded_Vector<T, N, Align>::Truncate(std::size_t count) noexcept
+{
+	// a loop over [count, m_size) bounded by CAPACITY too, so that the compiler sees every slot is inside the buffer
+	const std::size_t size = m_size;
+	for (std::size_t i = count; i < size && i < CAPACITY; ++i)
+		Destroy(Ptr_At(i));
+	if (count < size)
+		m_size = static_cast<Bounded_Size_t<CAPACITY>>(count);
+}
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr bool O::Bounded_Vector<T, N, Align>::Bitwise_Relocation() noexcept
+{
+	// constant evaluation has no memcpy: it goes through the element-wise paths
+	return Trivially_Copyable_Element<T> && !std::is_constant_evaluated();
 }
 
 // destructor
-template<typename T, std::size_t N>
-O::Bounded_Vector<T, N>::~Bounded_Vector() noexcept
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr O::Bounded_Vector<T, N, Align>::~Bounded_Vector() noexcept
 {
 	Clear();
 }
 
 // copy ctor
-template<typename T, std::size_t N>
-O::Bounded_Vector<T, N>::Bounded_Vector(const Bounded_Vector& other)
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr O::Bounded_Vector<T, N, Align>::Bounded_Vector(const Bounded_Vector& other)
 {
 	for (std::size_t i = 0; i < other.m_size; ++i)
-		new (&m_buffer[i]) T(*other.Ptr_At(i));
+		std::construct_at(Ptr_At(i), *other.Ptr_At(i));
 	m_size = other.m_size;
 }
 
 // move ctor
-template<typename T, std::size_t N>
-O::Bounded_Vector<T, N>::Bounded_Vector(Bounded_Vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr O::Bounded_Vector<T, N, Align>::Bounded_Vector(Bounded_Vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
 {
 	for (std::size_t i = 0; i < other.m_size; ++i) {
-		new (&m_buffer[i]) T(std::move(*other.Ptr_At(i)));
-		other.Ptr_At(i)->~T();
+		std::construct_at(Ptr_At(i), std::move(*other.Ptr_At(i)));
+		Destroy(other.Ptr_At(i));
 	}
 	m_size = other.m_size;
 	other.m_size = 0;
 }
 
 // copy assign
-template<typename T, std::size_t N>
-O::Bounded_Vector<T, N>& O::Bounded_Vector<T, N>::operator=(const Bounded_Vector& other)
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr O::Bounded_Vector<T, N, Align>& O::Bounded_Vector<T, N, Align>::operator=(const Bounded_Vector& other)
 {
 	if (this == &other) return *this;
-	Clear();
-	for (std::size_t i = 0; i < other.m_size; ++i)
-		new (&m_buffer[i]) T(*other.Ptr_At(i));
-	m_size = other.m_size;
+	// live slots are assigned, slots past Size() are constructed: no slot is read before it holds an element
+	if constexpr (!std::is_copy_assignable_v<T>)
+		Clear();
+	const std::size_t live = m_size < other.m_size ? m_size : other.m_size;
+	if constexpr (std::is_copy_assignable_v<T>)
+		for (std::size_t i = 0; i < live; ++i)
+			*Ptr_At(i) = *other.Ptr_At(i);
+	for (std::size_t i = live; i < other.m_size; ++i)
+	{
+		std::construct_at(Ptr_At(i), *other.Ptr_At(i));
+		++m_size;
+	}
+	Truncate(other.m_size);
 	return *this;
 }
 
 // move assign
-template<typename T, std::size_t N>
-O::Bounded_Vector<T, N>& O::Bounded_Vector<T, N>::operator=(Bounded_Vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr O::Bounded_Vector<T, N, Align>& O::Bounded_Vector<T, N, Align>::operator=(Bounded_Vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
 {
 	if (this == &other) return *this;
 	Clear();
 	for (std::size_t i = 0; i < other.m_size; ++i)
 	{
-		new (&m_buffer[i]) T(std::move(*other.Ptr_At(i)));
-		other.Ptr_At(i)->~T();
+		std::construct_at(Ptr_At(i), std::move(*other.Ptr_At(i)));
+		Destroy(other.Ptr_At(i));
 	}
 	m_size = other.m_size;
 	other.m_size = 0;
@@ -76,107 +134,417 @@ O::Bounded_Vector<T, N>& O::Bounded_Vector<T, N>::operator=(Bounded_Vector&& oth
 }
 
 // Capacity / state
-template<typename T, std::size_t N>
-constexpr std::size_t O::Bounded_Vector<T, N>::Capacity() const noexcept { return N; }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr std::size_t O::Bounded_Vector<T, N, Align>::Capacity() const noexcept { return CAPACITY; }
 
-template<typename T, std::size_t N>
-std::size_t O::Bounded_Vector<T, N>::Size() const noexcept { return m_size; }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr std::size_t O::Bounded_Vector<T, N, Align>::Size() const noexcept { return m_size; }
 
-template<typename T, std::size_t N>
-bool O::Bounded_Vector<T, N>::Empty() const noexcept { return m_size == 0; }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr bool O::Bounded_Vector<T, N, Align>::Empty() const noexcept { return m_size == 0; }
 
-template<typename T, std::size_t N>
-bool O::Bounded_Vector<T, N>::Full() const noexcept { return m_size == N; }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr bool O::Bounded_Vector<T, N, Align>::Full() const noexcept { return m_size == CAPACITY; }
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr std::size_t O::Bounded_Vector<T, N, Align>::Padded_Size() const noexcept requires Trivially_Copyable_Element<T>
+{
+	return (m_size + LANES - 1) / LANES * LANES;
+}
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr void O::Bounded_Vector<T, N, Align>::Fill_Padding(const T& value) noexcept requires Trivially_Copyable_Element<T>
+{
+	const std::size_t padded = Padded_Size();
+	for (std::size_t i = m_size; i < padded; ++i)
+		std::construct_at(Data() + i, value);
+}
 
 // element access
-template<typename T, std::size_t N>
-T& O::Bounded_Vector<T, N>::operator[](std::size_t i) noexcept { return *Ptr_At(i); }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr T& O::Bounded_Vector<T, N, Align>::operator[](std::size_t i) noexcept { return *Ptr_At(i); }
 
-template<typename T, std::size_t N>
-const T& O::Bounded_Vector<T, N>::operator[](std::size_t i) const noexcept { return *Ptr_At(i); }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr const T& O::Bounded_Vector<T, N, Align>::operator[](std::size_t i) const noexcept { return *Ptr_At(i); }
 
-template<typename T, std::size_t N>
-T& O::Bounded_Vector<T, N>::At(std::size_t i)
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr T& O::Bounded_Vector<T, N, Align>::At(std::size_t i)
 {
-	if (i >= m_size) throw Bounded_Vector_Exception::OUT_OF_RANGE;
+	if (i >= m_size) O_THROW(Bounded_Vector_Exception::OUT_OF_RANGE);
 	return *Ptr_At(i);
 }
 
-template<typename T, std::size_t N>
-const T& O::Bounded_Vector<T, N>::At(std::size_t i) const
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr const T& O::Bounded_Vector<T, N, Align>::At(std::size_t i) const
 {
-	if(i >= m_size)  throw Bounded_Vector_Exception::OUT_OF_RANGE;
+	if(i >= m_size)  O_THROW(Bounded_Vector_Exception::OUT_OF_RANGE);
 	return *Ptr_At(i);
 }
 
-template<typename T, std::size_t N>
-T* O::Bounded_Vector<T, N>::Data() noexcept { return Ptr_At(0); }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr T* O::Bounded_Vector<T, N, Align>::Data() noexcept { return std::assume_aligned<Align>(Ptr_At(0)); }
 
-template<typename T, std::size_t N>
-const T* O::Bounded_Vector<T, N>::Data() const noexcept { return Ptr_At(0); }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr const T* O::Bounded_Vector<T, N, Align>::Data() const noexcept { return std::assume_aligned<Align>(Ptr_At(0)); }
 
 // modifiers
-template<typename T, std::size_t N>
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
 template<class... Args>
-void O::Bounded_Vector<T, N>::Emplace_Back(Args&&... args)
+constexpr void O::Bounded_Vector<T, N, Align>::Emplace_Back(Args&&... args)
 {
-	if(Full()) throw  Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE;
-	new (&m_buffer[m_size]) T(std::forward<Args>(args)...);
+	if(Full()) O_THROW(Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+	std::construct_at(Ptr_At(m_size), std::forward<Args>(args)...);
 	++m_size;
 }
 
-template<typename T, std::size_t N>
-void O::Bounded_Vector<T, N>::Push_Back(const T& v) { Emplace_Back(v); }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr void O::Bounded_Vector<T, N, Align>::Push_Back(const T& v) { Emplace_Back(v); }
 
-template<typename T, std::size_t N>
-void O::Bounded_Vector<T, N>::Push_Back(T&& v) { Emplace_Back(std::move(v)); }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr void O::Bounded_Vector<T, N, Align>::Push_Back(T&& v) { Emplace_Back(std::move(v)); }
 
-template<typename T, std::size_t N>
-void O::Bounded_Vector<T, N>::Pop_Back()
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr void O::Bounded_Vector<T, N, Align>::Pop_Back()
 {
-	if(Empty()) throw Bounded_Vector_Exception::NO_MORE_ELEMENT_TO_POP;
+	if(Empty()) O_THROW(Bounded_Vector_Exception::NO_MORE_ELEMENT_TO_POP);
 	--m_size;
-	Ptr_At(m_size)->~T();
+	Destroy(Ptr_At(m_size));
 }
 
-template<typename T, std::size_t N>
-void O::Bounded_Vector<T, N>::Clear() noexcept
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr void O::Bounded_Vector<T, N, Align>::Clear() noexcept
 {
 	while (m_size > 0) {
 		--m_size;
-		Ptr_At(m_size)->~T();
+		Destroy(Ptr_At(m_size));
+	}
+}
+
+// non-throwing access / modifiers
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr O::Expected<T*, O::Bounded_Vector_Exception> O::Bounded_Vector<T, N, Align>::Try_At(std::size_t i) noexcept
+{
+	if (i >= m_size)
+		return Expected<T*, Bounded_Vector_Exception>::Make_Error(Bounded_Vector_Exception::OUT_OF_RANGE);
+	return Expected<T*, Bounded_Vector_Exception>::Make_Value(Ptr_At(i));
+}
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr O::Expected<const T*, O::Bounded_Vector_Exception> O::Bounded_Vector<T, N, Align>::Try_At(std::size_t i) const noexcept
+{
+	if (i >= m_size)
+		return Expected<const T*, Bounded_Vector_Exception>::Make_Error(Bounded_Vector_Exception::OUT_OF_RANGE);
+	return Expected<const T*, Bounded_Vector_Exception>::Make_Value(Ptr_At(i));
+}
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+template<class... Args>
+constexpr O::Expected<T*, O::Bounded_Vector_Exception> O::Bounded_Vector<T, N, Align>::Try_Emplace_Back(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args&&...>)
+{
+	if (Full())
+		return Expected<T*, Bounded_Vector_Exception>::Make_Error(Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+	T* elem = std::construct_at(Data() + m_size, std::forward<Args>(args)...);
+	++m_size;
+	return Expected<T*, Bounded_Vector_Exception>::Make_Value(elem);
+}
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr O::Expected<T, O::Bounded_Vector_Exception> O::Bounded_Vector<T, N, Align>::Try_Pop_Back() noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+	if (Empty())
+		return Expected<T, Bounded_Vector_Exception>::Make_Error(Bounded_Vector_Exception::NO_MORE_ELEMENT_TO_POP);
+	// move out first: if the move throws, the last element is still alive and counted
+	auto out = Expected<T, Bounded_Vector_Exception>::Make_Value(std::move(*Ptr_At(m_size - 1)));
+	Destroy(Ptr_At(m_size - 1));
+	--m_size;
+	return out;
+}
+
+// bulk modifiers
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+template<std::ranges::forward_range R>
+requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+constexpr void O::Bounded_Vector<T, N, Align>::Append(R&& range)
+{
+	const std::size_t count = static_cast<std::size_t>(std::ranges::distance(range));
+	if (count > CAPACITY - m_size) O_THROW(Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+
+	if constexpr (std::ranges::contiguous_range<R> && std::is_same_v<std::ranges::range_value_t<R>, T>)
+	{
+		if (Bitwise_Relocation())
+		{
+			if (count > 0)
+				std::memcpy(static_cast<void*>(Data() + m_size), static_cast<const void*>(std::ranges::data(range)), count * sizeof(T));
+			m_size = static_cast<Bounded_Size_t<CAPACITY>>(m_size + count);
+			return;
+		}
 	}
+	for (auto&& elem : range)
+	{
+		std::construct_at(Data() + m_size, std::forward<decltype(elem)>(elem));
+		++m_size;
+	}
+}
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+template<std::ranges::forward_range R>
+requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+constexpr T* O::Bounded_Vector<T, N, Align>::Insert(const T* pos, R&& range)
+{
+	assert(pos >= Data() && pos <= Data() + m_size && "Insert position out of the container");
+	const std::size_t index = static_cast<std::size_t>(pos - Data());
+	const std::size_t count = static_cast<std::size_t>(std::ranges::distance(range));
+	if (count > CAPACITY - m_size) O_THROW(Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+
+	if (Bitwise_Relocation())
+	{
+		// open the gap with a single memmove then write the range into it
+		if (count > 0 && index < m_size)
+			std::memmove(static_cast<void*>(Data() + index + count), static_cast<const void*>(Data() + index), (m_size - index) * sizeof(T));
+		std::size_t i = index;
+		for (auto&& elem : range)
+			std::construct_at(Data() + i++, std::forward<decltype(elem)>(elem));
+		m_size = static_cast<Bounded_Size_t<CAPACITY>>(m_size + count);
+	}
+	else
+	{
+		if constexpr (std::is_move_assignable_v<T>)
+		{
+			// build the range past the end, then rotate it into place: every slot below m_size stays alive, so a throw leaves nothing to destroy twice
+			const std::size_t size = m_size;
+			O_TRY
+			{
+				for (auto&& elem : range)
+				{
+					std::construct_at(Data() + m_size, std::forward<decltype(elem)>(elem));
+					++m_size;
+				}
+			}
+			O_CATCH_ALL
+			{
+				Truncate(size);
+				O_RETHROW;
+			}
+			std::rotate(Data() + index, Data() + size, Data() + m_size);
+		}
+		else
+		{
+			static_assert(std::is_nothrow_move_constructible_v<T>, "elements that cannot be move-assigned are relocated, their move must not throw");
+			// relocate the tail once to open the gap, then build the range into it
+			for (std::size_t i = m_size; i > index; --i)
+			{
+				std::construct_at(Data() + i - 1 + count, std::move(*Ptr_At(i - 1)));
+				Destroy(Ptr_At(i - 1));
+			}
+			std::size_t i = index;
+			O_TRY
+			{
+				for (auto&& elem : range)
+				{
+					std::construct_at(Data() + i, std::forward<decltype(elem)>(elem));
+					++i;
+				}
+			}
+			O_CATCH_ALL
+			{
+				// close the gap again so the container is left as it was
+				for (std::size_t j = index; j < i; ++j)
+					Destroy(Ptr_At(j));
+				for (std::size_t j = index; j < m_size; ++j)
+				{
+					std::construct_at(Data() + j, std::move(*(Data() + j + count)));
+					Destroy(Data() + j + count);
+				}
+				O_RETHROW;
+			}
+			m_size = static_cast<Bounded_Size_t<CAPACITY>>(m_size + count);
+		}
+	}
+	return Data() + index;
+}
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+template<class... Args>
+constexpr T* O::Bounded_Vector<T, N, Align>::Emplace(const T* pos, Args&&... args)
+{
+	assert(pos >= Data() && pos <= Data() + m_size && "Emplace position out of the container");
+	const std::size_t index = static_cast<std::size_t>(pos - Data());
+	if (Full()) O_THROW(Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+	if (index == m_size)
+	{
+		Emplace_Back(std::forward<Args>(args)...);
+		return Data() + index;
+	}
+
+	// build first: args may refer to an element that is about to be shifted
+	T value(std::forward<Args>(args)...);
+	if (Bitwise_Relocation())
+	{
+		std::memmove(static_cast<void*>(Data() + index + 1), static_cast<const void*>(Data() + index), (m_size - index) * sizeof(T));
+		std::construct_at(Data() + index, std::move(value));
+		++m_size;
+	}
+	else
+	{
+		if constexpr (std::is_move_assignable_v<T>)
+		{
+			// as std::vector: only the slot past the end is constructed, the others are shifted by move-assignment and stay alive
+			std::construct_at(Data() + m_size, std::move(*Ptr_At(m_size - 1)));
+			++m_size;
+			std::move_backward(Data() + index, Data() + m_size - 2, Data() + m_size - 1);
+			*Ptr_At(index) = std::move(value);
+		}
+		else
+		{
+			static_assert(std::is_nothrow_move_constructible_v<T>, "elements that cannot be move-assigned are relocated, their move must not throw");
+			for (std::size_t i = m_size; i > index; --i)
+			{
+				std::construct_at(Data() + i, std::move(*Ptr_At(i - 1)));
+				Destroy(Ptr_At(i - 1));
+			}
+			std::construct_at(Data() + index, std::move(value));
+			++m_size;
+		}
+	}
+	return Data() + index;
+}
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr T* O::Bounded_Vector<T, N, Align>::Erase(const T* first, const T* last)
+{
+	assert(first >= Data() && first <= last && last <= Data() + m_size && "Erase range out of the container");
+	const std::size_t index = static_cast<std::size_t>(first - Data());
+	const std::size_t count = static_cast<std::size_t>(last - first);
+	if (count == 0) return Data() + index;
+
+	if (Bitwise_Relocation())
+	{
+		std::memmove(static_cast<void*>(Data() + index), static_cast<const void*>(Data() + index + count), (m_size - index - count) * sizeof(T));
+		m_size = static_cast<Bounded_Size_t<CAPACITY>>(m_size - count);
+	}
+	else
+	{
+		if constexpr (std::is_move_assignable_v<T>)
+		{
+			// move-assign the tail down over the erased elements, then destroy the moved-from end
+			std::move(Data() + index + count, Data() + m_size, Data() + index);
+			Truncate(m_size - count);
+		}
+		else
+		{
+			static_assert(std::is_nothrow_move_constructible_v<T>, "elements that cannot be move-assigned are relocated, their move must not throw");
+			for (std::size_t i = index; i < index + count; ++i)
+				Destroy(Ptr_At(i));
+			for (std::size_t i = index + count; i < m_size; ++i)
+			{
+				std::construct_at(Data() + i - count, std::move(*Ptr_At(i)));
+				Destroy(Ptr_At(i));
+			}
+			m_size = static_cast<Bounded_Size_t<CAPACITY>>(m_size - count);
+		}
+	}
+	return Data() + index;
+}
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr T* O::Bounded_Vector<T, N, Align>::Erase(const T* pos) { return Erase(pos, pos + 1); }
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr void O::Bounded_Vector<T, N, Align>::Resize(std::size_t count)
+{
+	if (count > CAPACITY) O_THROW(Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+	Truncate(count);
+	while (m_size < count)
+	{
+		std::construct_at(Data() + m_size);
+		++m_size;
+	}
+}
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr void O::Bounded_Vector<T, N, Align>::Resize(std::size_t count, const T& value)
+{
+	if (count > CAPACITY) O_THROW(Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+	Truncate(count);
+	while (m_size < count)
+	{
+		std::construct_at(Data() + m_size, value);
+		++m_size;
+	}
+}
+
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr void O::Bounded_Vector<T, N, Align>::Resize_Uninitialized(std::size_t count) requires std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>
+{
+	if (count > CAPACITY) O_THROW(Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+	m_size = static_cast<Bounded_Size_t<CAPACITY>>(count);
 }
 
 // iterators
-template<typename T, std::size_t N>
-T* O::Bounded_Vector<T, N>::begin() noexcept { return Data(); }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr T* O::Bounded_Vector<T, N, Align>::begin() noexcept { return Data(); }
 
-template<typename T, std::size_t N>
-T* O::Bounded_Vector<T, N>::end() noexcept { return Data() + m_size; }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr T* O::Bounded_Vector<T, N, Align>::end() noexcept { return Data() + m_size; }
 
-template<typename T, std::size_t N>
-const T* O::Bounded_Vector<T, N>::begin() const noexcept { return Data(); }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr const T* O::Bounded_Vector<T, N, Align>::begin() const noexcept { return Data(); }
 
-template<typename T, std::size_t N>
-const T* O::Bounded_Vector<T, N>::end() const noexcept { return Data() + m_size; }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr const T* O::Bounded_Vector<T, N, Align>::end() const noexcept { return Data() + m_size; }
 
-template<typename T, std::size_t N>
-const T* O::Bounded_Vector<T, N>::cbegin() const noexcept { return Data(); }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr const T* O::Bounded_Vector<T, N, Align>::cbegin() const noexcept { return Data(); }
 
-template<typename T, std::size_t N>
-const T* O::Bounded_Vector<T, N>::cend() const noexcept { return Data() + m_size; }
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
+constexpr const T* O::Bounded_Vector<T, N, Align>::cend() const noexcept { return Data() + m_size; }
 
-template<typename T, std::size_t N>
+template<typename T, std::size_t N, std::size_t Align>
+requires (Align >= alignof(T)) && ((Align & (Align - 1)) == 0)
 template<typename... Args>
 requires (sizeof...(Args) <= N) && (std::constructible_from<T, Args> && ...)
-constexpr O::Bounded_Vector<T, N>::Bounded_Vector(Args&&... args)
+constexpr O::Bounded_Vector<T, N, Align>::Bounded_Vector(Args&&... args)
 {
 	std::size_t i = 0;
 	(
-		(::new (static_cast<void*>(Ptr_At(i++))) T(std::forward<Args>(args))),...
+		std::construct_at(Ptr_At(i++), std::forward<Args>(args)),...
 	);
-	m_size = sizeof...(Args);
+	m_size = static_cast<Bounded_Size_t<CAPACITY>>(sizeof...(Args));
 }
 
 #endif // UTILS_BOUNDED_ARRAY_HPP
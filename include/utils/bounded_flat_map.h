@@ -0,0 +1,179 @@
+// File: utils/bounded_flat_map.h
+#ifndef UTILS_BOUNDED_FLAT_MAP_H
+#define UTILS_BOUNDED_FLAT_MAP_H
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "bounded_array.h"
+#include "expected.h"
+
+namespace O
+{
+	/**
+	 * @brief Capacity up to which arithmetic keys are searched with a full linear compare instead of a binary search.
+	 */
+	inline constexpr std::size_t FLAT_LINEAR_SEARCH_LIMIT = 64;
+
+
+	/**
+	 * @brief Index of the first key not ordered before key in a sorted array.
+	 *        For arithmetic keys with std::less and N <= FLAT_LINEAR_SEARCH_LIMIT every key is compared and the results are
+	 *        summed: the loop has no branch and can be vectorized by the compiler (e.g. -O3). Otherwise a branchless binary search is used.
+	 *
+	 * @tparam N capacity of the searched container, used to pick the strategy at compile time
+	 * @param keys sorted keys
+	 * @param size number of keys
+	 * @param key searched key, a K or a type compare accepts against K
+	 * @param compare strict weak ordering of the keys
+	 * @return the insertion index of key
+	 */
+	template<std::size_t N, typename K, typename Q, typename Compare>
+	std::size_t Flat_Lower_Bound(const K* keys, std::size_t size, const Q& key, const Compare& compare) noexcept;
+
+
+	/**
+	 * @brief Types that the flat containers can look up without first building a K from them.
+	 *        With a transparent Compare (`is_transparent`, e.g. `std::less<>`), that is any type it accepts, as for `std::map`.
+	 *        With the default `std::less<K>`, it is any type that K orders against directly, e.g. `std::string_view` for `Bounded_String` keys.
+	 *        Such a lookup never converts the key. A conversion could throw (a text longer than a `Bounded_String`) or allocate.
+	 */
+	template<typename Q, typename K, typename Compare>
+	concept Flat_Lookup_Key = !std::is_same_v<std::remove_cvref_t<Q>, K>
+		&& (requires { typename Compare::is_transparent; }
+			|| (std::is_same_v<Compare, std::less<K>> && !std::is_arithmetic_v<K>
+				&& requires(const K& k, const Q& q) { { k < q } -> std::convertible_to<bool>; { q < k } -> std::convertible_to<bool>; }));
+
+
+	/**
+	 * @brief A sorted associative container with fixed capacity and no dynamic allocation.
+	 *        Keys and values are stored in two separate `Bounded_Vector` so that the search only walks the dense key array.
+	 *        Lookups never throw and report missing keys as `Bounded_Vector_Exception::KEY_NOT_FOUND` through `O::Expected`.
+	 *        Inserting into a full map throws `NO_MORE_PLACE_TO_EMPLACE` like `Bounded_Vector`.
+	 *
+	 * @tparam K Key type.
+	 * @tparam V Mapped type.
+	 * @tparam N Maximum number of entries.
+	 * @tparam Compare Strict weak ordering of the keys.
+	 */
+	template<typename K, typename V, std::size_t N, typename Compare = std::less<K>>
+	class Bounded_Flat_Map
+	{
+	private:
+		Bounded_Vector<K, N> m_keys;   ///< Sorted keys
+		Bounded_Vector<V, N> m_values; ///< Values, m_values[i] belongs to m_keys[i]
+		[[no_unique_address]] Compare m_compare;
+
+		/** @name Internal helpers
+		 *  @{ */
+		template<typename Q> std::size_t Lower_Bound(const Q& key) const noexcept;
+		template<typename Q> bool Is_Key_At(std::size_t index, const Q& key) const noexcept;
+		template<typename Q> decltype(auto) Lookup_Compare() const noexcept; ///< m_compare, or std::less<> for a Flat_Lookup_Key
+		/** @} */
+
+	public:
+		/** @name Capacity / state
+		 *  @{ */
+		constexpr std::size_t Capacity() const noexcept;
+		std::size_t Size() const noexcept;
+		bool Empty() const noexcept;
+		bool Full() const noexcept;
+		/** @} */
+
+		/** @name Lookup
+		 *  @brief Exception-free lookups, the returned pointer stays valid until the map is modified.
+		 *         A Flat_Lookup_Key (e.g. a `std::string_view` for `Bounded_String` keys) is compared as is, never converted to K.
+		 *  @{ */
+		Expected<V*, Bounded_Vector_Exception> Find(const K& key) noexcept;
+		Expected<const V*, Bounded_Vector_Exception> Find(const K& key) const noexcept;
+		bool Contains(const K& key) const noexcept;
+		template<typename Q> requires Flat_Lookup_Key<Q, K, Compare>
+		Expected<V*, Bounded_Vector_Exception> Find(const Q& key) noexcept;
+		template<typename Q> requires Flat_Lookup_Key<Q, K, Compare>
+		Expected<const V*, Bounded_Vector_Exception> Find(const Q& key) const noexcept;
+		template<typename Q> requires Flat_Lookup_Key<Q, K, Compare>
+		bool Contains(const Q& key) const noexcept;
+		/** @} */
+
+		/** @name Modifiers
+		 *  @brief Insert() keeps the existing value and returns false when the key is already present.
+		 *  @{ */
+		bool Insert(const K& key, const V& value);
+		bool Insert(K&& key, V&& value);
+		bool Insert_Or_Assign(const K& key, const V& value);
+		bool Erase(const K& key);
+		void Clear() noexcept;
+		/** @} */
+
+		/** @name Views
+		 *  @brief Keys in increasing order and their values at the same indices, e.g. for `O::Zip`.
+		 *  @{ */
+		std::span<const K> Keys() const noexcept;
+		std::span<V> Values() noexcept;
+		std::span<const V> Values() const noexcept;
+		/** @} */
+	};
+
+
+	/**
+	 * @brief A sorted set with fixed capacity and no dynamic allocation, sharing the search strategy of `Bounded_Flat_Map`.
+	 *
+	 * @tparam K Key type.
+	 * @tparam N Maximum number of keys.
+	 * @tparam Compare Strict weak ordering of the keys.
+	 */
+	template<typename K, std::size_t N, typename Compare = std::less<K>>
+	class Bounded_Flat_Set
+	{
+	private:
+		Bounded_Vector<K, N> m_keys; ///< Sorted keys
+		[[no_unique_address]] Compare m_compare;
+
+		template<typename Q> std::size_t Lower_Bound(const Q& key) const noexcept;
+		template<typename Q> bool Is_Key_At(std::size_t index, const Q& key) const noexcept;
+		template<typename Q> decltype(auto) Lookup_Compare() const noexcept; ///< m_compare, or std::less<> for a Flat_Lookup_Key
+
+	public:
+		/** @name Capacity / state
+		 *  @{ */
+		constexpr std::size_t Capacity() const noexcept;
+		std::size_t Size() const noexcept;
+		bool Empty() const noexcept;
+		bool Full() const noexcept;
+		/** @} */
+
+		/** @name Lookup
+		 *  @brief A Flat_Lookup_Key is compared as is, never converted to K.
+		 *  @{ */
+		Expected<const K*, Bounded_Vector_Exception> Find(const K& key) const noexcept;
+		bool Contains(const K& key) const noexcept;
+		template<typename Q> requires Flat_Lookup_Key<Q, K, Compare>
+		Expected<const K*, Bounded_Vector_Exception> Find(const Q& key) const noexcept;
+		template<typename Q> requires Flat_Lookup_Key<Q, K, Compare>
+		bool Contains(const Q& key) const noexcept;
+		/** @} */
+
+		/** @name Modifiers
+		 *  @{ */
+		bool Insert(const K& key);
+		bool Insert(K&& key);
+		bool Erase(const K& key);
+		void Clear() noexcept;
+		/** @} */
+
+		/** @name Iterators
+		 *  @brief Keys in increasing order.
+		 *  @{ */
+		const K* begin() const noexcept;
+		const K* end() const noexcept;
+		/** @} */
+	};
+}
+
+#include "bounded_flat_map.hpp"
+
+#endif //UTILS_BOUNDED_FLAT_MAP_H
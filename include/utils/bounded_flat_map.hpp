@@ -0,0 +1,305 @@
+#ifndef UTILS_BOUNDED_FLAT_MAP_HPP
+#define UTILS_BOUNDED_FLAT_MAP_HPP
+
+#include "bounded_flat_map.h"
+#include <utility>
+
+
+// search
+template<std::size_t N, typename K, typename Q, typename Compare>
+std::size_t O::Flat_Lower_Bound(const K* keys, std::size_t size, const Q& key, const Compare& compare) noexcept
+{
+	if constexpr (std::is_arithmetic_v<K> && std::is_same_v<Compare, std::less<K>> && N <= FLAT_LINEAR_SEARCH_LIMIT)
+	{
+		// count the keys lower than key: no branch, vectorized
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < size; ++i)
+			count += static_cast<std::size_t>(keys[i] < key);
+		return count;
+	}
+	else
+	{
+		if (size == 0) return 0;
+		// the range is halved each step with a conditional move instead of a branch
+		const K* base = keys;
+		std::size_t length = size;
+		while (length > 1)
+		{
+			const std::size_t half = length / 2;
+			base = compare(base[half], key) ? base + half : base;
+			length -= half;
+		}
+		return static_cast<std::size_t>(base - keys) + static_cast<std::size_t>(compare(*base, key));
+	}
+}
+
+// ----------------------------- Bounded_Flat_Map -----------------------------
+// helper implementations
+template<typename K, typename V, std::size_t N, typename Compare>
+template<typename Q>
+decltype(auto) O::Bounded_Flat_Map<K, V, N, Compare>::Lookup_Compare() const noexcept
+{
+	if constexpr (std::is_same_v<Q, K> || requires { typename Compare::is_transparent; })
+		return (m_compare);
+	else
+		return std::less<>{};
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+template<typename Q>
+std::size_t O::Bounded_Flat_Map<K, V, N, Compare>::Lower_Bound(const Q& key) const noexcept
+{
+	return Flat_Lower_Bound<N>(m_keys.Data(), m_keys.Size(), key, Lookup_Compare<Q>());
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+template<typename Q>
+bool O::Bounded_Flat_Map<K, V, N, Compare>::Is_Key_At(std::size_t index, const Q& key) const noexcept
+{
+	return index < m_keys.Size() && !Lookup_Compare<Q>()(key, m_keys[index]);
+}
+
+// Capacity / state
+template<typename K, typename V, std::size_t N, typename Compare>
+constexpr std::size_t O::Bounded_Flat_Map<K, V, N, Compare>::Capacity() const noexcept { return N; }
+
+template<typename K, typename V, std::size_t N, typename Compare>
+std::size_t O::Bounded_Flat_Map<K, V, N, Compare>::Size() const noexcept { return m_keys.Size(); }
+
+template<typename K, typename V, std::size_t N, typename Compare>
+bool O::Bounded_Flat_Map<K, V, N, Compare>::Empty() const noexcept { return m_keys.Empty(); }
+
+template<typename K, typename V, std::size_t N, typename Compare>
+bool O::Bounded_Flat_Map<K, V, N, Compare>::Full() const noexcept { return m_keys.Full(); }
+
+// lookup
+template<typename K, typename V, std::size_t N, typename Compare>
+O::Expected<V*, O::Bounded_Vector_Exception> O::Bounded_Flat_Map<K, V, N, Compare>::Find(const K& key) noexcept
+{
+	const std::size_t index = Lower_Bound(key);
+	if (!Is_Key_At(index, key))
+		return Expected<V*, Bounded_Vector_Exception>::Make_Error(Bounded_Vector_Exception::KEY_NOT_FOUND);
+	return Expected<V*, Bounded_Vector_Exception>::Make_Value(&m_values[index]);
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+O::Expected<const V*, O::Bounded_Vector_Exception> O::Bounded_Flat_Map<K, V, N, Compare>::Find(const K& key) const noexcept
+{
+	const std::size_t index = Lower_Bound(key);
+	if (!Is_Key_At(index, key))
+		return Expected<const V*, Bounded_Vector_Exception>::Make_Error(Bounded_Vector_Exception::KEY_NOT_FOUND);
+	return Expected<const V*, Bounded_Vector_Exception>::Make_Value(&m_values[index]);
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+bool O::Bounded_Flat_Map<K, V, N, Compare>::Contains(const K& key) const noexcept
+{
+	return Is_Key_At(Lower_Bound(key), key);
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+template<typename Q> requires O::Flat_Lookup_Key<Q, K, Compare>
+O::Expected<V*, O::Bounded_Vector_Exception> O::Bounded_Flat_Map<K, V, N, Compare>::Find(const Q& key) noexcept
+{
+	const std::size_t index = Lower_Bound(key);
+	if (!Is_Key_At(index, key))
+		return Expected<V*, Bounded_Vector_Exception>::Make_Error(Bounded_Vector_Exception::KEY_NOT_FOUND);
+	return Expected<V*, Bounded_Vector_Exception>::Make_Value(&m_values[index]);
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+template<typename Q> requires O::Flat_Lookup_Key<Q, K, Compare>
+O::Expected<const V*, O::Bounded_Vector_Exception> O::Bounded_Flat_Map<K, V, N, Compare>::Find(const Q& key) const noexcept
+{
+	const std::size_t index = Lower_Bound(key);
+	if (!Is_Key_At(index, key))
+		return Expected<const V*, Bounded_Vector_Exception>::Make_Error(Bounded_Vector_Exception::KEY_NOT_FOUND);
+	return Expected<const V*, Bounded_Vector_Exception>::Make_Value(&m_values[index]);
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+template<typename Q> requires O::Flat_Lookup_Key<Q, K, Compare>
+bool O::Bounded_Flat_Map<K, V, N, Compare>::Contains(const Q& key) const noexcept
+{
+	return Is_Key_At(Lower_Bound(key), key);
+}
+
+// modifiers
+template<typename K, typename V, std::size_t N, typename Compare>
+bool O::Bounded_Flat_Map<K, V, N, Compare>::Insert(const K& key, const V& value)
+{
+	return Insert(K(key), V(value));
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+bool O::Bounded_Flat_Map<K, V, N, Compare>::Insert(K&& key, V&& value)
+{
+	const std::size_t index = Lower_Bound(key);
+	if (Is_Key_At(index, key))
+		return false;
+	if (Full()) O_THROW(Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+
+	m_keys.Emplace(m_keys.begin() + index, std::move(key));
+	O_TRY
+	{
+		m_values.Emplace(m_values.begin() + index, std::move(value));
+	}
+	O_CATCH_ALL
+	{
+		m_keys.Erase(m_keys.begin() + index);
+		O_RETHROW;
+	}
+	return true;
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+bool O::Bounded_Flat_Map<K, V, N, Compare>::Insert_Or_Assign(const K& key, const V& value)
+{
+	const std::size_t index = Lower_Bound(key);
+	if (Is_Key_At(index, key))
+	{
+		m_values[index] = value;
+		return false;
+	}
+	return Insert(key, value);
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+bool O::Bounded_Flat_Map<K, V, N, Compare>::Erase(const K& key)
+{
+	const std::size_t index = Lower_Bound(key);
+	if (!Is_Key_At(index, key))
+		return false;
+	m_keys.Erase(m_keys.begin() + index);
+	m_values.Erase(m_values.begin() + index);
+	return true;
+}
+
+template<typename K, typename V, std::size_t N, typename Compare>
+void O::Bounded_Flat_Map<K, V, N, Compare>::Clear() noexcept
+{
+	m_keys.Clear();
+	m_values.Clear();
+}
+
+// views
+template<typename K, typename V, std::size_t N, typename Compare>
+std::span<const K> O::Bounded_Flat_Map<K, V, N, Compare>::Keys() const noexcept { return std::span<const K>(m_keys.Data(), m_keys.Size()); }
+
+template<typename K, typename V, std::size_t N, typename Compare>
+std::span<V> O::Bounded_Flat_Map<K, V, N, Compare>::Values() noexcept { return std::span<V>(m_values.Data(), m_values.Size()); }
+
+template<typename K, typename V, std::size_t N, typename Compare>
+std::span<const V> O::Bounded_Flat_Map<K, V, N, Compare>::Values() const noexcept { return std::span<const V>(m_values.Data(), m_values.Size()); }
+
+// ----------------------------- Bounded_Flat_Set -----------------------------
+// helper implementations
+template<typename K, std::size_t N, typename Compare>
+template<typename Q>
+decltype(auto) O::Bounded_Flat_Set<K, N, Compare>::Lookup_Compare() const noexcept
+{
+	if constexpr (std::is_same_v<Q, K> || requires { typename Compare::is_transparent; })
+		return (m_compare);
+	else
+		return std::less<>{};
+}
+
+template<typename K, std::size_t N, typename Compare>
+template<typename Q>
+std::size_t O::Bounded_Flat_Set<K, N, Compare>::Lower_Bound(const Q& key) const noexcept
+{
+	return Flat_Lower_Bound<N>(m_keys.Data(), m_keys.Size(), key, Lookup_Compare<Q>());
+}
+
+template<typename K, std::size_t N, typename Compare>
+template<typename Q>
+bool O::Bounded_Flat_Set<K, N, Compare>::Is_Key_At(std::size_t index, const Q& key) const noexcept
+{
+	return index < m_keys.Size() && !Lookup_Compare<Q>()(key, m_keys[index]);
+}
+
+// Capacity / state
+template<typename K, std::size_t N, typename Compare>
+constexpr std::size_t O::Bounded_Flat_Set<K, N, Compare>::Capacity() const noexcept { return N; }
+
+template<typename K, std::size_t N, typename Compare>
+std::size_t O::Bounded_Flat_Set<K, N, Compare>::Size() const noexcept { return m_keys.Size(); }
+
+template<typename K, std::size_t N, typename Compare>
+bool O::Bounded_Flat_Set<K, N, Compare>::Empty() const noexcept { return m_keys.Empty(); }
+
+template<typename K, std::size_t N, typename Compare>
+bool O::Bounded_Flat_Set<K, N, Compare>::Full() const noexcept { return m_keys.Full(); }
+
+// lookup
+template<typename K, std::size_t N, typename Compare>
+O::Expected<const K*, O::Bounded_Vector_Exception> O::Bounded_Flat_Set<K, N, Compare>::Find(const K& key) const noexcept
+{
+	const std::size_t index = Lower_Bound(key);
+	if (!Is_Key_At(index, key))
+		return Expected<const K*, Bounded_Vector_Exception>::Make_Error(Bounded_Vector_Exception::KEY_NOT_FOUND);
+	return Expected<const K*, Bounded_Vector_Exception>::Make_Value(&m_keys[index]);
+}
+
+template<typename K, std::size_t N, typename Compare>
+bool O::Bounded_Flat_Set<K, N, Compare>::Contains(const K& key) const noexcept
+{
+	return Is_Key_At(Lower_Bound(key), key);
+}
+
+template<typename K, std::size_t N, typename Compare>
+template<typename Q> requires O::Flat_Lookup_Key<Q, K, Compare>
+O::Expected<const K*, O::Bounded_Vector_Exception> O::Bounded_Flat_Set<K, N, Compare>::Find(const Q& key) const noexcept
+{
+	const std::size_t index = Lower_Bound(key);
+	if (!Is_Key_At(index, key))
+		return Expected<const K*, Bounded_Vector_Exception>::Make_Error(Bounded_Vector_Exception::KEY_NOT_FOUND);
+	return Expected<const K*, Bounded_Vector_Exception>::Make_Value(&m_keys[index]);
+}
+
+template<typename K, std::size_t N, typename Compare>
+template<typename Q> requires O::Flat_Lookup_Key<Q, K, Compare>
+bool O::Bounded_Flat_Set<K, N, Compare>::Contains(const Q& key) const noexcept
+{
+	return Is_Key_At(Lower_Bound(key), key);
+}
+
+// modifiers
+template<typename K, std::size_t N, typename Compare>
+bool O::Bounded_Flat_Set<K, N, Compare>::Insert(const K& key)
+{
+	return Insert(K(key));
+}
+
+template<typename K, std::size_t N, typename Compare>
+bool O::Bounded_Flat_Set<K, N, Compare>::Insert(K&& key)
+{
+	const std::size_t index = Lower_Bound(key);
+	if (Is_Key_At(index, key))
+		return false;
+	if (Full()) O_THROW(Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+	m_keys.Emplace(m_keys.begin() + index, std::move(key));
+	return true;
+}
+
+template<typename K, std::size_t N, typename Compare>
+bool O::Bounded_Flat_Set<K, N, Compare>::Erase(const K& key)
+{
+	const std::size_t index = Lower_Bound(key);
+	if (!Is_Key_At(index, key))
+		return false;
+	m_keys.Erase(m_keys.begin() + index);
+	return true;
+}
+
+template<typename K, std::size_t N, typename Compare>
+void O::Bounded_Flat_Set<K, N, Compare>::Clear() noexcept { m_keys.Clear(); }
+
+// iterators
+template<typename K, std::size_t N, typename Compare>
+const K* O::Bounded_Flat_Set<K, N, Compare>::begin() const noexcept { return m_keys.begin(); }
+
+template<typename K, std::size_t N, typename Compare>
+const K* O::Bounded_Flat_Set<K, N, Compare>::end() const noexcept { return m_keys.end(); }
+
+#endif // UTILS_BOUNDED_FLAT_MAP_HPP
@@ -0,0 +1,111 @@
+// File: utils/bounded_ring.h
+#ifndef UTILS_BOUNDED_RING_H
+#define UTILS_BOUNDED_RING_H
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "bounded_array.h"
+
+namespace O
+{
+	/**
+	 * @brief A fixed-capacity double-ended ring buffer with no dynamic allocation.
+	 *        Elements live in the same aligned storage as `Bounded_Vector` and wrap around its end.
+	 *        Push and pop are O(1) at both ends, the slot index is computed with a mask so N must be a power of two.
+	 *        The content can be read as at most two contiguous spans (`First_Span()` then `Second_Span()`),
+	 *        which can be handed to `O::Zip` or `O::For_Each_Indexed` without copying.
+	 *
+	 * @tparam T Type of stored elements.
+	 * @tparam N Maximum number of elements, must be a power of two.
+	 */
+	template<typename T, std::size_t N>
+	requires (N > 0) && ((N & (N - 1)) == 0)
+	class Bounded_Ring
+	{
+	private:
+		static constexpr std::size_t MASK = N - 1;
+
+		Bounded_Storage<T, N> m_buffer;    ///< Element slots, a live range may wrap around the end
+		Bounded_Size_t<N> m_head = 0;      ///< Physical slot of the front element
+		Bounded_Size_t<N> m_size = 0;      ///< Number of live elements
+
+		/** @name Internal helpers
+		 *  @brief Pointer to the physical slot holding the i-th logical element.
+		 *  @{ */
+		T* Ptr_At(std::size_t i) noexcept;
+		const T* Ptr_At(std::size_t i) const noexcept;
+		void Copy_From(const Bounded_Ring& other);
+		void Move_From(Bounded_Ring&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+		/** @} */
+
+	public:
+		/** @name Construction / assignment
+		 *  @brief Same rules as `Bounded_Vector`: defaulted (trivially copyable ring) when T is trivially copyable,
+		 *         otherwise element-wise copies and moves that leave the moved-from ring empty.
+		 *  @{ */
+		constexpr Bounded_Ring() noexcept = default;
+		~Bounded_Ring() noexcept requires Trivially_Copyable_Element<T> = default;
+		~Bounded_Ring() noexcept;
+		Bounded_Ring(const Bounded_Ring& other) requires Trivially_Copyable_Element<T> = default;
+		Bounded_Ring(const Bounded_Ring& other);
+		Bounded_Ring(Bounded_Ring&& other) noexcept requires Trivially_Copyable_Element<T> = default;
+		Bounded_Ring(Bounded_Ring&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+		Bounded_Ring& operator=(const Bounded_Ring& other) requires Trivially_Copyable_Element<T> = default;
+		Bounded_Ring& operator=(const Bounded_Ring& other);
+		Bounded_Ring& operator=(Bounded_Ring&& other) noexcept requires Trivially_Copyable_Element<T> = default;
+		Bounded_Ring& operator=(Bounded_Ring&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+		/** @} */
+
+		/** @name Capacity / state
+		 *  @{ */
+		constexpr std::size_t Capacity() const noexcept;
+		std::size_t Size() const noexcept;
+		bool Empty() const noexcept;
+		bool Full() const noexcept;
+		/** @} */
+
+		/** @name Element access
+		 *  @brief Logical indexing: 0 is the front, Size()-1 the back.
+		 *  @{ */
+		T& operator[](std::size_t i) noexcept;
+		const T& operator[](std::size_t i) const noexcept;
+		T& At(std::size_t i);
+		const T& At(std::size_t i) const;
+		T& Front() noexcept;
+		const T& Front() const noexcept;
+		T& Back() noexcept;
+		const T& Back() const noexcept;
+		/** @} */
+
+		/** @name Contiguous views
+		 *  @brief The content in order is First_Span() followed by Second_Span(); the second one is empty unless the content wraps.
+		 *  @{ */
+		std::span<T> First_Span() noexcept;
+		std::span<const T> First_Span() const noexcept;
+		std::span<T> Second_Span() noexcept;
+		std::span<const T> Second_Span() const noexcept;
+		/** @} */
+
+		/** @name Modifiers
+		 *  @{ */
+		template<class... Args>
+		void Emplace_Back(Args&&... args);
+		template<class... Args>
+		void Emplace_Front(Args&&... args);
+		void Push_Back(const T& v);
+		void Push_Back(T&& v);
+		void Push_Front(const T& v);
+		void Push_Front(T&& v);
+		void Pop_Back();
+		void Pop_Front();
+		void Clear() noexcept;
+		/** @} */
+	};
+}
+
+#include "bounded_ring.hpp"
+
+#endif //UTILS_BOUNDED_RING_H
@@ -0,0 +1,252 @@
+#ifndef UTILS_BOUNDED_RING_HPP
+#define UTILS_BOUNDED_RING_HPP
+
+#include "bounded_ring.h"
+#include <memory>
+#include <utility>
+
+
+// helper implementations
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+T* O::Bounded_Ring<T, N>::Ptr_At(std::size_t i) noexcept
+{
+	return m_buffer.elements + ((m_head + i) & MASK);
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+const T* O::Bounded_Ring<T, N>::Ptr_At(std::size_t i) const noexcept
+{
+	return m_buffer.elements + ((m_head + i) & MASK);
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+void O::Bounded_Ring<T, N>::Copy_From(const Bounded_Ring& other)
+{
+	// the copy is re-packed from slot 0
+	m_head = 0;
+	for (std::size_t i = 0; i < other.m_size; ++i)
+	{
+		std::construct_at(m_buffer.elements + i, *other.Ptr_At(i));
+		++m_size;
+	}
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+void O::Bounded_Ring<T, N>::Move_From(Bounded_Ring&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+	m_head = 0;
+	for (std::size_t i = 0; i < other.m_size; ++i)
+	{
+		std::construct_at(m_buffer.elements + i, std::move(*other.Ptr_At(i)));
+		++m_size;
+	}
+	other.Clear();
+}
+
+// construction / destruction
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+O::Bounded_Ring<T, N>::~Bounded_Ring() noexcept
+{
+	Clear();
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+O::Bounded_Ring<T, N>::Bounded_Ring(const Bounded_Ring& other)
+{
+	Copy_From(other);
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+O::Bounded_Ring<T, N>::Bounded_Ring(Bounded_Ring&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+	Move_From(std::move(other));
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+O::Bounded_Ring<T, N>& O::Bounded_Ring<T, N>::operator=(const Bounded_Ring& other)
+{
+	if (this == &other) return *this;
+	Clear();
+	Copy_From(other);
+	return *this;
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+O::Bounded_Ring<T, N>& O::Bounded_Ring<T, N>::operator=(Bounded_Ring&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+	if (this == &other) return *this;
+	Clear();
+	Move_From(std::move(other));
+	return *this;
+}
+
+// Capacity / state
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+constexpr std::size_t O::Bounded_Ring<T, N>::Capacity() const noexcept { return N; }
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+std::size_t O::Bounded_Ring<T, N>::Size() const noexcept { return m_size; }
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+bool O::Bounded_Ring<T, N>::Empty() const noexcept { return m_size == 0; }
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+bool O::Bounded_Ring<T, N>::Full() const noexcept { return m_size == N; }
+
+// element access
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+T& O::Bounded_Ring<T, N>::operator[](std::size_t i) noexcept { return *Ptr_At(i); }
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+const T& O::Bounded_Ring<T, N>::operator[](std::size_t i) const noexcept { return *Ptr_At(i); }
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+T& O::Bounded_Ring<T, N>::At(std::size_t i)
+{
+	if (i >= m_size) O_THROW(Bounded_Vector_Exception::OUT_OF_RANGE);
+	return *Ptr_At(i);
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+const T& O::Bounded_Ring<T, N>::At(std::size_t i) const
+{
+	if (i >= m_size) O_THROW(Bounded_Vector_Exception::OUT_OF_RANGE);
+	return *Ptr_At(i);
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+T& O::Bounded_Ring<T, N>::Front() noexcept { return *Ptr_At(0); }
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+const T& O::Bounded_Ring<T, N>::Front() const noexcept { return *Ptr_At(0); }
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+T& O::Bounded_Ring<T, N>::Back() noexcept { return *Ptr_At(m_size - 1); }
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+const T& O::Bounded_Ring<T, N>::Back() const noexcept { return *Ptr_At(m_size - 1); }
+
+// contiguous views
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+std::span<T> O::Bounded_Ring<T, N>::First_Span() noexcept
+{
+	const std::size_t first = (m_size < N - m_head) ? m_size : N - m_head;
+	return std::span<T>(m_buffer.elements + m_head, first);
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+std::span<const T> O::Bounded_Ring<T, N>::First_Span() const noexcept
+{
+	const std::size_t first = (m_size < N - m_head) ? m_size : N - m_head;
+	return std::span<const T>(m_buffer.elements + m_head, first);
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+std::span<T> O::Bounded_Ring<T, N>::Second_Span() noexcept
+{
+	const std::size_t first = (m_size < N - m_head) ? m_size : N - m_head;
+	return std::span<T>(m_buffer.elements, m_size - first);
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+std::span<const T> O::Bounded_Ring<T, N>::Second_Span() const noexcept
+{
+	const std::size_t first = (m_size < N - m_head) ? m_size : N - m_head;
+	return std::span<const T>(m_buffer.elements, m_size - first);
+}
+
+// modifiers
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+template<class... Args>
+void O::Bounded_Ring<T, N>::Emplace_Back(Args&&... args)
+{
+	if (Full()) O_THROW(Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+	std::construct_at(Ptr_At(m_size), std::forward<Args>(args)...);
+	++m_size;
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+template<class... Args>
+void O::Bounded_Ring<T, N>::Emplace_Front(Args&&... args)
+{
+	if (Full()) O_THROW(Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+	const std::size_t new_head = (m_head + N - 1) & MASK;
+	std::construct_at(m_buffer.elements + new_head, std::forward<Args>(args)...);
+	m_head = static_cast<Bounded_Size_t<N>>(new_head);
+	++m_size;
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+void O::Bounded_Ring<T, N>::Push_Back(const T& v) { Emplace_Back(v); }
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+void O::Bounded_Ring<T, N>::Push_Back(T&& v) { Emplace_Back(std::move(v)); }
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+void O::Bounded_Ring<T, N>::Push_Front(const T& v) { Emplace_Front(v); }
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+void O::Bounded_Ring<T, N>::Push_Front(T&& v) { Emplace_Front(std::move(v)); }
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+void O::Bounded_Ring<T, N>::Pop_Back()
+{
+	if (Empty()) O_THROW(Bounded_Vector_Exception::NO_MORE_ELEMENT_TO_POP);
+	--m_size;
+	Ptr_At(m_size)->~T();
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+void O::Bounded_Ring<T, N>::Pop_Front()
+{
+	if (Empty()) O_THROW(Bounded_Vector_Exception::NO_MORE_ELEMENT_TO_POP);
+	Ptr_At(0)->~T();
+	m_head = static_cast<Bounded_Size_t<N>>((m_head + 1) & MASK);
+	--m_size;
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+void O::Bounded_Ring<T, N>::Clear() noexcept
+{
+	while (m_size > 0) {
+		--m_size;
+		Ptr_At(m_size)->~T();
+	}
+	m_head = 0;
+}
+
+#endif // UTILS_BOUNDED_RING_HPP
@@ -0,0 +1,177 @@
+// File: utils/bounded_soa.h
+#ifndef UTILS_BOUNDED_SOA_H
+#define UTILS_BOUNDED_SOA_H
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "bounded_array.h"
+#include "zip.h"
+
+namespace O
+{
+	/**
+	 * @brief A fixed-capacity structure-of-arrays container with no dynamic allocation.
+	 *        Each field of a record is stored in its own aligned array, so a kernel touching two fields only streams those two columns.
+	 *        `Column<I>()` returns a contiguous span of one field (vectorizable loops, `O::For_Each_Zip`, `O::Zip`), while
+	 *        iterating the container itself yields a `std::tuple` of references to every field of a row, usable with
+	 *        structured bindings and with `O::Zip_Index`.
+	 *        Every column starts on a `COLUMN_ALIGNMENT` boundary (at least `O::SIMD_BYTES`), so full-width aligned SIMD loads are valid from `Column<I>().data()`.
+	 *
+	 * @tparam N Maximum number of records.
+	 * @tparam Ts Field types, one column per type.
+	 */
+	template<std::size_t N, typename... Ts>
+	requires (sizeof...(Ts) > 0)
+	class Bounded_SoA
+	{
+	public:
+		template<std::size_t I>
+		using Field_t = std::tuple_element_t<I, std::tuple<Ts...>>;
+		using Reference = std::tuple<Ts&...>;
+		using Const_Reference = std::tuple<const Ts&...>;
+
+		/// Alignment of every column, the widest SIMD register or the most aligned field type
+		static constexpr std::size_t COLUMN_ALIGNMENT = std::max({SIMD_BYTES, alignof(Ts)...});
+
+	private:
+		/// Byte offset of each column inside the storage, every column starts on a COLUMN_ALIGNMENT boundary
+		static constexpr std::array<std::size_t, sizeof...(Ts) + 1> OFFSETS = [] {
+			std::array<std::size_t, sizeof...(Ts) + 1> offsets{};
+			std::size_t offset = 0;
+			std::size_t i = 0;
+			((offset = (offset + COLUMN_ALIGNMENT - 1) / COLUMN_ALIGNMENT * COLUMN_ALIGNMENT, offsets[i++] = offset, offset += sizeof(Ts) * N), ...);
+			offsets[i] = offset;
+			return offsets;
+		}();
+
+		alignas(COLUMN_ALIGNMENT) std::array<std::byte, OFFSETS.back()> m_storage; ///< Uninitialized columns, one after the other
+		Bounded_Size_t<N> m_size = 0;                                   ///< Number of records
+
+		/** @name Internal helpers
+		 *  @{ */
+		template<std::size_t I>
+		Field_t<I>* Column_Data() noexcept;
+		template<std::size_t I>
+		const Field_t<I>* Column_Data() const noexcept;
+		void Destroy_Row(std::size_t row) noexcept;
+		void Copy_From(const Bounded_SoA& other);
+		void Move_From(Bounded_SoA&& other) noexcept((std::is_nothrow_move_constructible_v<Ts> && ...));
+		/** @} */
+
+		/**
+		 * @brief Random-access iterator over rows, dereferencing to a tuple of references.
+		 */
+		template<bool Const>
+		class Iterator_Impl
+		{
+			using owner_t = std::conditional_t<Const, const Bounded_SoA, Bounded_SoA>;
+
+		public:
+			// const rows have no common reference with std::tuple<Ts...> before C++23, the proxy is its own value type
+			using value_type = std::conditional_t<Const, Const_Reference, std::tuple<Ts...>>;
+			using reference = std::conditional_t<Const, Const_Reference, Reference>;
+			using difference_type = std::ptrdiff_t;
+			using iterator_concept = std::random_access_iterator_tag;
+			using iterator_category = std::input_iterator_tag;
+
+			Iterator_Impl() = default;
+			Iterator_Impl(owner_t* owner, std::size_t index) noexcept : m_owner(owner), m_index(static_cast<difference_type>(index)) {}
+
+			reference operator*() const noexcept { return (*m_owner)[static_cast<std::size_t>(m_index)]; }
+			reference operator[](difference_type n) const noexcept { return (*m_owner)[static_cast<std::size_t>(m_index + n)]; }
+
+			Iterator_Impl& operator++() noexcept { ++m_index; return *this; }
+			Iterator_Impl operator++(int) noexcept { Iterator_Impl tmp = *this; ++m_index; return tmp; }
+			Iterator_Impl& operator--() noexcept { --m_index; return *this; }
+			Iterator_Impl operator--(int) noexcept { Iterator_Impl tmp = *this; --m_index; return tmp; }
+			Iterator_Impl& operator+=(difference_type n) noexcept { m_index += n; return *this; }
+			Iterator_Impl& operator-=(difference_type n) noexcept { m_index -= n; return *this; }
+
+			friend Iterator_Impl operator+(Iterator_Impl it, difference_type n) noexcept { return it += n; }
+			friend Iterator_Impl operator+(difference_type n, Iterator_Impl it) noexcept { return it += n; }
+			friend Iterator_Impl operator-(Iterator_Impl it, difference_type n) noexcept { return it -= n; }
+			friend difference_type operator-(const Iterator_Impl& a, const Iterator_Impl& b) noexcept { return a.m_index - b.m_index; }
+
+			bool operator==(const Iterator_Impl& other) const noexcept { return m_index == other.m_index; }
+			std::strong_ordering operator<=>(const Iterator_Impl& other) const noexcept { return m_index <=> other.m_index; }
+
+		private:
+			owner_t* m_owner = nullptr;
+			difference_type m_index = 0;
+		};
+
+	public:
+		using iterator = Iterator_Impl<false>;
+		using const_iterator = Iterator_Impl<true>;
+
+		/** @name Construction / assignment
+		 *  @brief Defaulted (trivially copyable container) when every field is trivially copyable,
+		 *         otherwise row-wise copies and moves that leave the moved-from container empty.
+		 *  @{ */
+		constexpr Bounded_SoA() noexcept = default;
+		~Bounded_SoA() noexcept requires (Trivially_Copyable_Element<Ts> && ...) = default;
+		~Bounded_SoA() noexcept;
+		Bounded_SoA(const Bounded_SoA& other) requires (Trivially_Copyable_Element<Ts> && ...) = default;
+		Bounded_SoA(const Bounded_SoA& other);
+		Bounded_SoA(Bounded_SoA&& other) noexcept requires (Trivially_Copyable_Element<Ts> && ...) = default;
+		Bounded_SoA(Bounded_SoA&& other) noexcept((std::is_nothrow_move_constructible_v<Ts> && ...));
+		Bounded_SoA& operator=(const Bounded_SoA& other) requires (Trivially_Copyable_Element<Ts> && ...) = default;
+		Bounded_SoA& operator=(const Bounded_SoA& other);
+		Bounded_SoA& operator=(Bounded_SoA&& other) noexcept requires (Trivially_Copyable_Element<Ts> && ...) = default;
+		Bounded_SoA& operator=(Bounded_SoA&& other) noexcept((std::is_nothrow_move_constructible_v<Ts> && ...));
+		/** @} */
+
+		/** @name Capacity / state
+		 *  @{ */
+		constexpr std::size_t Capacity() const noexcept;
+		std::size_t Size() const noexcept;
+		bool Empty() const noexcept;
+		bool Full() const noexcept;
+		/** @} */
+
+		/** @name Element access
+		 *  @brief Rows as tuples of references, columns as contiguous spans.
+		 *  @{ */
+		Reference operator[](std::size_t i) noexcept;
+		Const_Reference operator[](std::size_t i) const noexcept;
+		Reference At(std::size_t i);
+		Const_Reference At(std::size_t i) const;
+		template<std::size_t I>
+		std::span<Field_t<I>> Column() noexcept;
+		template<std::size_t I>
+		std::span<const Field_t<I>> Column() const noexcept;
+		/** @} */
+
+		/** @name Modifiers
+		 *  @brief Emplace_Back takes one constructor argument per field.
+		 *  @{ */
+		template<typename... Us>
+		requires (sizeof...(Us) == sizeof...(Ts)) && (std::constructible_from<Ts, Us> && ...)
+		void Emplace_Back(Us&&... fields);
+		void Push_Back(const Ts&... fields);
+		void Pop_Back();
+		void Clear() noexcept;
+		/** @} */
+
+		/** @name Iterators
+		 *  @{ */
+		iterator begin() noexcept;
+		iterator end() noexcept;
+		const_iterator begin() const noexcept;
+		const_iterator end() const noexcept;
+		/** @} */
+	};
+}
+
+#include "bounded_soa.hpp"
+
+#endif //UTILS_BOUNDED_SOA_H
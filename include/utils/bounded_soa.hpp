@@ -0,0 +1,225 @@
+#ifndef UTILS_BOUNDED_SOA_HPP
+#define UTILS_BOUNDED_SOA_HPP
+
+#include "bounded_soa.h"
+#include <utility>
+
+
+// helper implementations
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+template<std::size_t I>
+typename O::Bounded_SoA<N, Ts...>::template Field_t<I>* O::Bounded_SoA<N, Ts...>::Column_Data() noexcept
+{
+	return reinterpret_cast<Field_t<I>*>(m_storage.data() + OFFSETS[I]);
+}
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+template<std::size_t I>
+const typename O::Bounded_SoA<N, Ts...>::template Field_t<I>* O::Bounded_SoA<N, Ts...>::Column_Data() const noexcept
+{
+	return reinterpret_cast<const Field_t<I>*>(m_storage.data() + OFFSETS[I]);
+}
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+void O::Bounded_SoA<N, Ts...>::Destroy_Row(std::size_t row) noexcept
+{
+	[&]<std::size_t... I>(std::index_sequence<I...>) {
+		((Column_Data<I>() + row)->~Field_t<I>(), ...);
+	}(std::index_sequence_for<Ts...>{});
+}
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+void O::Bounded_SoA<N, Ts...>::Copy_From(const Bounded_SoA& other)
+{
+	for (std::size_t row = 0; row < other.m_size; ++row)
+		std::apply([this](const Ts&... fields) { Push_Back(fields...); }, other[row]);
+}
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+void O::Bounded_SoA<N, Ts...>::Move_From(Bounded_SoA&& other) noexcept((std::is_nothrow_move_constructible_v<Ts> && ...))
+{
+	for (std::size_t row = 0; row < other.m_size; ++row)
+		std::apply([this](Ts&... fields) { Emplace_Back(std::move(fields)...); }, other[row]);
+	other.Clear();
+}
+
+// construction / destruction
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+O::Bounded_SoA<N, Ts...>::~Bounded_SoA() noexcept
+{
+	Clear();
+}
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+O::Bounded_SoA<N, Ts...>::Bounded_SoA(const Bounded_SoA& other)
+{
+	Copy_From(other);
+}
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+O::Bounded_SoA<N, Ts...>::Bounded_SoA(Bounded_SoA&& other) noexcept((std::is_nothrow_move_constructible_v<Ts> && ...))
+{
+	Move_From(std::move(other));
+}
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+O::Bounded_SoA<N, Ts...>& O::Bounded_SoA<N, Ts...>::operator=(const Bounded_SoA& other)
+{
+	if (this == &other) return *this;
+	Clear();
+	Copy_From(other);
+	return *this;
+}
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+O::Bounded_SoA<N, Ts...>& O::Bounded_SoA<N, Ts...>::operator=(Bounded_SoA&& other) noexcept((std::is_nothrow_move_constructible_v<Ts> && ...))
+{
+	if (this == &other) return *this;
+	Clear();
+	Move_From(std::move(other));
+	return *this;
+}
+
+// Capacity / state
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+constexpr std::size_t O::Bounded_SoA<N, Ts...>::Capacity() const noexcept { return N; }
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+std::size_t O::Bounded_SoA<N, Ts...>::Size() const noexcept { return m_size; }
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+bool O::Bounded_SoA<N, Ts...>::Empty() const noexcept { return m_size == 0; }
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+bool O::Bounded_SoA<N, Ts...>::Full() const noexcept { return m_size == N; }
+
+// element access
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+typename O::Bounded_SoA<N, Ts...>::Reference O::Bounded_SoA<N, Ts...>::operator[](std::size_t i) noexcept
+{
+	return [&]<std::size_t... I>(std::index_sequence<I...>) {
+		return Reference(Column_Data<I>()[i]...);
+	}(std::index_sequence_for<Ts...>{});
+}
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+typename O::Bounded_SoA<N, Ts...>::Const_Reference O::Bounded_SoA<N, Ts...>::operator[](std::size_t i) const noexcept
+{
+	return [&]<std::size_t... I>(std::index_sequence<I...>) {
+		return Const_Reference(Column_Data<I>()[i]...);
+	}(std::index_sequence_for<Ts...>{});
+}
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+typename O::Bounded_SoA<N, Ts...>::Reference O::Bounded_SoA<N, Ts...>::At(std::size_t i)
+{
+	if (i >= m_size) O_THROW(Bounded_Vector_Exception::OUT_OF_RANGE);
+	return (*this)[i];
+}
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+typename O::Bounded_SoA<N, Ts...>::Const_Reference O::Bounded_SoA<N, Ts...>::At(std::size_t i) const
+{
+	if (i >= m_size) O_THROW(Bounded_Vector_Exception::OUT_OF_RANGE);
+	return (*this)[i];
+}
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+template<std::size_t I>
+std::span<typename O::Bounded_SoA<N, Ts...>::template Field_t<I>> O::Bounded_SoA<N, Ts...>::Column() noexcept
+{
+	return std::span<Field_t<I>>(Column_Data<I>(), m_size);
+}
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+template<std::size_t I>
+std::span<const typename O::Bounded_SoA<N, Ts...>::template Field_t<I>> O::Bounded_SoA<N, Ts...>::Column() const noexcept
+{
+	return std::span<const Field_t<I>>(Column_Data<I>(), m_size);
+}
+
+// modifiers
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+template<typename... Us>
+requires (sizeof...(Us) == sizeof...(Ts)) && (std::constructible_from<Ts, Us> && ...)
+void O::Bounded_SoA<N, Ts...>::Emplace_Back(Us&&... fields)
+{
+	if (Full()) O_THROW(Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+	[&]<std::size_t... I>(std::index_sequence<I...>) {
+		std::size_t built = 0;
+		O_TRY
+		{
+			((::new (static_cast<void*>(Column_Data<I>() + m_size)) Field_t<I>(std::forward<Us>(fields)), ++built), ...);
+		}
+		O_CATCH_ALL
+		{
+			// undo the fields of this row that were already built
+			((I < built ? (Column_Data<I>() + m_size)->~Field_t<I>() : void()), ...);
+			O_RETHROW;
+		}
+	}(std::index_sequence_for<Ts...>{});
+	++m_size;
+}
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+void O::Bounded_SoA<N, Ts...>::Push_Back(const Ts&... fields) { Emplace_Back(fields...); }
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+void O::Bounded_SoA<N, Ts...>::Pop_Back()
+{
+	if (Empty()) O_THROW(Bounded_Vector_Exception::NO_MORE_ELEMENT_TO_POP);
+	--m_size;
+	Destroy_Row(m_size);
+}
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+void O::Bounded_SoA<N, Ts...>::Clear() noexcept
+{
+	while (m_size > 0) {
+		--m_size;
+		Destroy_Row(m_size);
+	}
+}
+
+// iterators
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+typename O::Bounded_SoA<N, Ts...>::iterator O::Bounded_SoA<N, Ts...>::begin() noexcept { return iterator(this, 0); }
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+typename O::Bounded_SoA<N, Ts...>::iterator O::Bounded_SoA<N, Ts...>::end() noexcept { return iterator(this, m_size); }
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+typename O::Bounded_SoA<N, Ts...>::const_iterator O::Bounded_SoA<N, Ts...>::begin() const noexcept { return const_iterator(this, 0); }
+
+template<std::size_t N, typename... Ts>
+requires (sizeof...(Ts) > 0)
+typename O::Bounded_SoA<N, Ts...>::const_iterator O::Bounded_SoA<N, Ts...>::end() const noexcept { return const_iterator(this, m_size); }
+
+#endif // UTILS_BOUNDED_SOA_HPP
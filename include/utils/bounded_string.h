@@ -0,0 +1,101 @@
+// File: utils/bounded_string.h
+#ifndef UTILS_BOUNDED_STRING_H
+#define UTILS_BOUNDED_STRING_H
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+#include "bounded_array.h"
+
+namespace O
+{
+	/**
+	 * @brief A fixed-capacity string storing its characters inline, with no dynamic allocation.
+	 *        Like `Bounded_Vector`, the size field is the narrowest type able to hold N and the whole object is trivially copyable.
+	 *        There is no small/large mode so no branch on access. Content is not null-terminated, use `View()` for interop.
+	 *        Exceeding the capacity throws `Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE`.
+	 *        Bounded strings are totally ordered and hashable (`std::hash` specialization), so they can be used as keys
+	 *        in `Bounded_Flat_Map`, `Bounded_Flat_Set` or `std::unordered_map`.
+	 *
+	 * @tparam N Maximum number of characters.
+	 */
+	template<std::size_t N>
+	class Bounded_String
+	{
+	private:
+		std::array<char, N> m_chars;     ///< Characters, only the first m_size are meaningful
+		Bounded_Size_t<N> m_size = 0;    ///< Number of characters
+
+	public:
+		/** @name Construction
+		 *  @brief Implicit from string views and literals, like `std::string`. Throws when the text does not fit.
+		 *  @{ */
+		constexpr Bounded_String() noexcept = default;
+		Bounded_String(std::string_view text);
+		Bounded_String(const char* text);
+		/** @} */
+
+		/** @name Capacity / state
+		 *  @{ */
+		static constexpr std::size_t Capacity() noexcept;
+		std::size_t Size() const noexcept;
+		bool Empty() const noexcept;
+		bool Full() const noexcept;
+		/** @} */
+
+		/** @name Access
+		 *  @{ */
+		char& operator[](std::size_t i) noexcept;
+		const char& operator[](std::size_t i) const noexcept;
+		char* Data() noexcept;
+		const char* Data() const noexcept;
+		std::string_view View() const noexcept;
+		operator std::string_view() const noexcept;
+		/** @} */
+
+		/** @name Modifiers
+		 *  @brief Append() checks the capacity once for the whole text.
+		 *  @{ */
+		void Push_Back(char c);
+		void Append(std::string_view text);
+		Bounded_String& operator+=(std::string_view text);
+		Bounded_String& operator+=(char c);
+		void Clear() noexcept;
+		/** @} */
+
+		/** @name Comparison
+		 *  @brief Lexicographic, against other bounded strings of any capacity and against string views.
+		 *  @{ */
+		template<std::size_t M>
+		bool operator==(const Bounded_String<M>& other) const noexcept;
+		template<std::size_t M>
+		std::strong_ordering operator<=>(const Bounded_String<M>& other) const noexcept;
+		bool operator==(std::string_view other) const noexcept;
+		std::strong_ordering operator<=>(std::string_view other) const noexcept;
+		/** @} */
+
+		/** @name Iterators
+		 *  @{ */
+		char* begin() noexcept;
+		char* end() noexcept;
+		const char* begin() const noexcept;
+		const char* end() const noexcept;
+		/** @} */
+	};
+}
+
+/**
+ * @brief Hash of a bounded string, equal to the hash of the same text as a std::string_view.
+ */
+template<std::size_t N>
+struct std::hash<O::Bounded_String<N>>
+{
+	std::size_t operator()(const O::Bounded_String<N>& s) const noexcept;
+};
+
+#include "bounded_string.hpp"
+
+#endif //UTILS_BOUNDED_STRING_H
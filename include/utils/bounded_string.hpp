@@ -0,0 +1,124 @@
+#ifndef UTILS_BOUNDED_STRING_HPP
+#define UTILS_BOUNDED_STRING_HPP
+
+#include "bounded_string.h"
+#include <cstring>
+
+
+// construction
+template<std::size_t N>
+O::Bounded_String<N>::Bounded_String(std::string_view text)
+{
+	Append(text);
+}
+
+template<std::size_t N>
+O::Bounded_String<N>::Bounded_String(const char* text) :
+	Bounded_String(std::string_view(text))
+{
+
+}
+
+// Capacity / state
+template<std::size_t N>
+constexpr std::size_t O::Bounded_String<N>::Capacity() noexcept { return N; }
+
+template<std::size_t N>
+std::size_t O::Bounded_String<N>::Size() const noexcept { return m_size; }
+
+template<std::size_t N>
+bool O::Bounded_String<N>::Empty() const noexcept { return m_size == 0; }
+
+template<std::size_t N>
+bool O::Bounded_String<N>::Full() const noexcept { return m_size == N; }
+
+// access
+template<std::size_t N>
+char& O::Bounded_String<N>::operator[](std::size_t i) noexcept { return m_chars[i]; }
+
+template<std::size_t N>
+const char& O::Bounded_String<N>::operator[](std::size_t i) const noexcept { return m_chars[i]; }
+
+template<std::size_t N>
+char* O::Bounded_String<N>::Data() noexcept { return m_chars.data(); }
+
+template<std::size_t N>
+const char* O::Bounded_String<N>::Data() const noexcept { return m_chars.data(); }
+
+template<std::size_t N>
+std::string_view O::Bounded_String<N>::View() const noexcept { return std::string_view(m_chars.data(), m_size); }
+
+template<std::size_t N>
+O::Bounded_String<N>::operator std::string_view() const noexcept { return View(); }
+
+// modifiers
+template<std::size_t N>
+void O::Bounded_String<N>::Push_Back(char c)
+{
+	if (Full()) O_THROW(Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+	m_chars[m_size] = c;
+	++m_size;
+}
+
+template<std::size_t N>
+void O::Bounded_String<N>::Append(std::string_view text)
+{
+	if (text.size() > N - m_size) O_THROW(Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+	if (!text.empty())
+		std::memmove(m_chars.data() + m_size, text.data(), text.size());
+	m_size = static_cast<Bounded_Size_t<N>>(m_size + text.size());
+}
+
+template<std::size_t N>
+O::Bounded_String<N>& O::Bounded_String<N>::operator+=(std::string_view text)
+{
+	Append(text);
+	return *this;
+}
+
+template<std::size_t N>
+O::Bounded_String<N>& O::Bounded_String<N>::operator+=(char c)
+{
+	Push_Back(c);
+	return *this;
+}
+
+template<std::size_t N>
+void O::Bounded_String<N>::Clear() noexcept { m_size = 0; }
+
+// comparison
+template<std::size_t N>
+template<std::size_t M>
+bool O::Bounded_String<N>::operator==(const Bounded_String<M>& other) const noexcept { return View() == other.View(); }
+
+template<std::size_t N>
+template<std::size_t M>
+std::strong_ordering O::Bounded_String<N>::operator<=>(const Bounded_String<M>& other) const noexcept { return View() <=> other.View(); }
+
+template<std::size_t N>
+bool O::Bounded_String<N>::operator==(std::string_view other) const noexcept { return View() == other; }
+
+template<std::size_t N>
+std::strong_ordering O::Bounded_String<N>::operator<=>(std::string_view other) const noexcept { return View() <=> other; }
+
+// iterators
+template<std::size_t N>
+char* O::Bounded_String<N>::begin() noexcept { return m_chars.data(); }
+
+template<std::size_t N>
+char* O::Bounded_String<N>::end() noexcept { return m_chars.data() + m_size; }
+
+template<std::size_t N>
+const char* O::Bounded_String<N>::begin() const noexcept { return m_chars.data(); }
+
+template<std::size_t N>
+const char* O::Bounded_String<N>::end() const noexcept { return m_chars.data() + m_size; }
+
+// hash
+template<std::size_t N>
+std::size_t std::hash<O::Bounded_String<N>>::operator()(const O::Bounded_String<N>& s) const noexcept
+{
+	return std::hash<std::string_view>{}(s.View());
+}
+
+#endif // UTILS_BOUNDED_STRING_HPP
@@ -0,0 +1,136 @@
+// File: utils/error_code.h
+#ifndef UTILS_ERROR_CODE_H
+#define UTILS_ERROR_CODE_H
+
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "niche.h"
+
+namespace O
+{
+	/**
+	 * @brief Describes one family of error codes: its name and how to turn a code into a message.
+	 *        Registered once in Error_Registry, and only read when an Error_Code is formatted.
+	 */
+	struct Error_Category
+	{
+		const char* name;                                    ///< Short name, e.g. "parse"
+		const char* (*message)(std::int32_t code) noexcept;  ///< Message of a code, nullptr when the code is unknown
+	};
+
+
+	/**
+	 * @brief Process-wide table of error categories, indexed by category id.
+	 *
+	 * Lookups are lock-free reads of a fixed array: formatting an error never allocates nor locks.
+	 * Ids range over [1, CAPACITY), 0 is the "no category" of a default Error_Code.
+	 */
+	class Error_Registry
+	{
+	public:
+		static constexpr std::uint32_t CAPACITY = 256;
+
+		/**
+		 * @brief Binds a category id to its description, which must outlive every lookup (a static object).
+		 * @return false when the id is out of range or already bound to another description.
+		 */
+		[[nodiscard]] static bool Register(std::uint32_t category, const Error_Category& description) noexcept;
+
+		/// Description bound to the id, nullptr if none
+		static const Error_Category* Find(std::uint32_t category) noexcept;
+
+	private:
+		static std::atomic<const Error_Category*>* Table() noexcept;
+	};
+
+
+	/**
+	 * @brief Customization point letting an error enum convert implicitly to Error_Code.
+	 *
+	 * A specialization provides:
+	 *  - `static constexpr bool ENABLED = true;`
+	 *  - `static constexpr std::uint32_t CATEGORY;` the category id of the enum, in [1, Error_Registry::CAPACITY)
+	 *
+	 * @code
+	 * enum class Parse_Error : std::int32_t { EMPTY = 1, NOT_A_NUMBER };
+	 * template<> struct O::Error_Code_Enum<Parse_Error>
+	 * {
+	 *     static constexpr bool ENABLED = true;
+	 *     static constexpr std::uint32_t CATEGORY = 3;
+	 * };
+	 * @endcode
+	 */
+	template<typename Enum>
+	struct Error_Code_Enum
+	{
+		static constexpr bool ENABLED = false;
+	};
+
+	template<typename Enum>
+	concept Error_Code_Enumeration = std::is_enum_v<Enum> && Error_Code_Enum<Enum>::ENABLED;
+
+
+	/**
+	 * @brief Compact error value for `O::Expected`: a category id and a 32-bit code, 8 bytes, trivially copyable.
+	 *
+	 * Building, copying and comparing an Error_Code never allocates. The text is resolved through Error_Registry
+	 * only when Category_Name(), Message() or To_String() is called.
+	 * The spare high-order byte of the category id is a niche (see Niche_Traits): `Expected<int, Error_Code>` takes 8 bytes.
+	 */
+	class Error_Code
+	{
+	public:
+		constexpr Error_Code() noexcept = default;
+		/// A category id outside [0, Error_Registry::CAPACITY) asserts in debug builds and is stored as 0 otherwise
+		constexpr Error_Code(std::uint32_t category, std::int32_t code) noexcept;
+		template<Error_Code_Enumeration Enum>
+		constexpr Error_Code(Enum code) noexcept;
+
+		/** @name Queries */
+		/**@{*/
+		constexpr std::uint32_t Category() const noexcept;
+		constexpr std::int32_t Code() const noexcept;
+
+		/// True when the code is `code` of its enum's category
+		template<Error_Code_Enumeration Enum>
+		constexpr bool Is(Enum code) const noexcept;
+		/**@}*/
+
+		/** @name Formatting (registry lookups) */
+		/**@{*/
+		const char* Category_Name() const noexcept;   ///< "unknown category" when the id is not registered
+		const char* Message() const noexcept;         ///< "unknown error" when the category has no message for the code
+		std::string To_String() const;                ///< "<category>: <message> (<code>)"
+		/**@}*/
+
+		friend constexpr bool operator==(const Error_Code&, const Error_Code&) noexcept = default;
+
+	private:
+		std::uint32_t m_category = 0; // first member: Niche_Traits<Error_Code> reads its high-order byte
+		std::int32_t m_code = 0;
+	};
+
+	static_assert(sizeof(Error_Code) == 8 && std::is_standard_layout_v<Error_Code> && std::is_trivially_copyable_v<Error_Code>);
+
+
+	/// Category ids stay below Error_Registry::CAPACITY, so the high-order byte of the id is always zero in a valid Error_Code
+	template<>
+	struct Niche_Traits<Error_Code>
+	{
+		static constexpr bool ENABLED = true;
+		using Tag = std::uint8_t;
+		static constexpr std::size_t TAG_OFFSET = std::endian::native == std::endian::little ? sizeof(std::uint32_t) - 1 : 0;
+		static constexpr Tag FIRST_SPARE_TAG = 0xFE;
+		static constexpr Tag SECOND_SPARE_TAG = 0xFF;
+	};
+}
+
+#include "error_code.hpp"
+
+#endif //UTILS_ERROR_CODE_H
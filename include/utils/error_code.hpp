@@ -0,0 +1,80 @@
+#ifndef UTILS_ERROR_CODE_HPP
+#define UTILS_ERROR_CODE_HPP
+
+#include "error_code.h"
+
+namespace O
+{
+
+	// --- Error_Registry ---
+	inline std::atomic<const Error_Category*>* Error_Registry::Table() noexcept
+	{
+		// constant-initialized: no guard on the lookup path
+		static std::atomic<const Error_Category*> table[CAPACITY];
+		return table;
+	}
+
+	inline bool Error_Registry::Register(std::uint32_t category, const Error_Category& description) noexcept
+	{
+		if (category == 0 || category >= CAPACITY)
+			return false;
+		const Error_Category* expected = nullptr;
+		return Table()[category].compare_exchange_strong(expected, &description, std::memory_order_acq_rel) || expected == &description;
+	}
+
+	inline const Error_Category* Error_Registry::Find(std::uint32_t category) noexcept
+	{
+		if (category >= CAPACITY)
+			return nullptr;
+		return Table()[category].load(std::memory_order_acquire);
+	}
+
+	// --- Error_Code ---
+	// an out-of-range id would put a spare tag in the niche byte: it becomes 0, the "no category" id, in release builds too
+	constexpr Error_Code::Error_Code(std::uint32_t category, std::int32_t code) noexcept :
+		m_category(category < Error_Registry::CAPACITY ? category : 0), m_code(code)
+	{
+		assert(category < Error_Registry::CAPACITY && "error category id out of range");
+	}
+
+	template<Error_Code_Enumeration Enum>
+	constexpr Error_Code::Error_Code(Enum code) noexcept : Error_Code(Error_Code_Enum<Enum>::CATEGORY, static_cast<std::int32_t>(code))
+	{
+		static_assert(Error_Code_Enum<Enum>::CATEGORY > 0 && Error_Code_Enum<Enum>::CATEGORY < Error_Registry::CAPACITY,
+			"Error_Code_Enum<Enum>::CATEGORY must be in [1, Error_Registry::CAPACITY)");
+	}
+
+	constexpr std::uint32_t Error_Code::Category() const noexcept { return m_category; }
+
+	constexpr std::int32_t Error_Code::Code() const noexcept { return m_code; }
+
+	template<Error_Code_Enumeration Enum>
+	constexpr bool Error_Code::Is(Enum code) const noexcept { return *this == Error_Code(code); }
+
+	inline const char* Error_Code::Category_Name() const noexcept
+	{
+		const Error_Category* category = Error_Registry::Find(m_category);
+		return category && category->name ? category->name : "unknown category";
+	}
+
+	inline const char* Error_Code::Message() const noexcept
+	{
+		const Error_Category* category = Error_Registry::Find(m_category);
+		const char* message = category && category->message ? category->message(m_code) : nullptr;
+		return message ? message : "unknown error";
+	}
+
+	inline std::string Error_Code::To_String() const
+	{
+		std::string out = Category_Name();
+		out += ": ";
+		out += Message();
+		out += " (";
+		out += std::to_string(m_code);
+		out += ')';
+		return out;
+	}
+
+} // namespace O
+
+#endif // UTILS_ERROR_CODE_HPP
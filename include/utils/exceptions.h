@@ -0,0 +1,42 @@
+// File: utils/exceptions.h
+#ifndef UTILS_EXCEPTIONS_H
+#define UTILS_EXCEPTIONS_H
+
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * @brief Compile-time exception switch for the utils headers.
+ *        Exceptions are disabled when `O_UTILS_NO_EXCEPTIONS` is defined or when the compiler itself runs without them (`-fno-exceptions`, `/EHs-c-`).
+ *        In that mode every throwing path of the containers calls `O::Terminate_On_Error()` instead, and the `Try_*` members returning `O::Expected` are the way to handle errors.
+ *
+ *  - `O_THROW(e)` throws `e`, or terminates.
+ *  - `O_TRY` / `O_CATCH_ALL` / `O_RETHROW` wrap the rollback blocks used by the containers; without exceptions only the `O_TRY` block is kept.
+ */
+#if !defined(O_UTILS_NO_EXCEPTIONS) && (defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND))
+	#define O_UTILS_HAS_EXCEPTIONS 1
+	#define O_THROW(exception) throw exception
+	#define O_TRY try
+	#define O_CATCH_ALL catch (...)
+	#define O_RETHROW throw
+#else
+	#define O_UTILS_HAS_EXCEPTIONS 0
+	#define O_THROW(exception) ::O::Terminate_On_Error(#exception)
+	#define O_TRY if constexpr (true)
+	#define O_CATCH_ALL else
+	#define O_RETHROW static_cast<void>(0)
+#endif
+
+namespace O
+{
+	/**
+	 * @brief Error sink of exception-free builds: reports what would have been thrown and aborts.
+	 */
+	[[noreturn]] inline void Terminate_On_Error(const char* what) noexcept
+	{
+		std::fprintf(stderr, "O::utils: unrecoverable error %s\n", what);
+		std::abort();
+	}
+}
+
+#endif // UTILS_EXCEPTIONS_H
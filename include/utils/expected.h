@@ -8,6 +8,23 @@
 #include <cassert>
 #include <cstddef>
 #include <memory>
+#include <concepts>
+#include <functional>
+#include <cstring>
+#include <version>
+
+#include "exceptions.h"
+#include "niche.h"
+
+/**
+ * @brief Niche-packed Expected layouts are constant-evaluable when the standard library can tell which union member is alive (`std::is_within_lifetime`, C++26).
+ *        Their discriminant is otherwise only readable from the object representation, which constant evaluation forbids for pointers and unions.
+ */
+#if defined(__cpp_lib_is_within_lifetime)
+	#define O_UTILS_CONSTEXPR_NICHE 1
+#else
+	#define O_UTILS_CONSTEXPR_NICHE 0
+#endif
 
 namespace O
 {
@@ -16,22 +33,253 @@ namespace O
 	 * @brief Exception thrown when accessing the value/error of an empty Expected.
 	 *
 	 * Thin wrapper over std::runtime_error used by Value()/Error() accessors.
+	 * Builds without exceptions terminate instead (see exceptions.h): check Has_Value()/Has_Error() first.
 	 */
 	struct bad_expected_access : std::runtime_error
 	{
 		using std::runtime_error::runtime_error;
 	};
 
+	/**
+	 * @brief Payloads for which Expected can be copied at all: both alternatives are copy constructible.
+	 */
+	template<class T, class E>
+	concept Copyable_Payload = std::copy_constructible<T> && std::copy_constructible<E>;
+
+
+	/**
+	 * @brief Payloads for which Expected defaults all its special members.
+	 *        Expected is then trivially copyable and trivially destructible itself, so small instances are returned in registers.
+	 */
+	template<class T, class E>
+	concept Trivial_Payload = Copyable_Payload<T, E>
+		&& std::is_trivially_copyable_v<T> && std::is_trivially_copyable_v<E>
+		&& std::is_trivially_destructible_v<T> && std::is_trivially_destructible_v<E>;
+
+
+	/// Alternative currently held by an Expected
+	enum class Expected_Active : unsigned char { None = 0, Value = 1, Error = 2 };
+
+
+	template<class T, class E>
+	class Expected;
+
+	/// True for specializations of Expected
+	template<class X>
+	inline constexpr bool Is_Expected_v = false;
+
+	template<class T, class E>
+	inline constexpr bool Is_Expected_v<Expected<T, E>> = true;
+
+	/**
+	 * @brief Argument of the converting constructors: anything but an Expected (the same one or another), as for std::expected.
+	 *        Otherwise copying a non-const `Expected<bool, E>` would go through its explicit operator bool and build a value.
+	 */
+	template<class U>
+	concept Not_Expected = !Is_Expected_v<std::remove_cvref_t<U>>;
+
+
+	/**
+	 * @brief Default Expected layout: a union of T and E next to an Expected_Active discriminant.
+	 */
+	template<class T, class E>
+	struct Expected_Tagged_Storage
+	{
+		union Storage
+		{
+			struct Empty {} empty; // active while neither is, so that an empty Expected is a complete constant
+			T value;
+			E error;
+			constexpr Storage() noexcept : empty() {}
+			~Storage() noexcept requires Trivial_Payload<T, E> = default;
+			constexpr ~Storage() noexcept {}
+		} m_union;
+
+		Expected_Active m_active;
+
+		constexpr Expected_Active State() const noexcept { return m_active; }
+		constexpr void Set_State(Expected_Active active) noexcept
+		{
+			if (active == Expected_Active::None && std::is_constant_evaluated())
+				std::construct_at(&m_union.empty);
+			m_active = active;
+		}
+		constexpr T& Value() noexcept { return m_union.value; }
+		constexpr const T& Value() const noexcept { return m_union.value; }
+		constexpr E& Error() noexcept { return m_union.error; }
+		constexpr const E& Error() const noexcept { return m_union.error; }
+	};
+
+
+	/**
+	 * @brief The non-carrier alternative of a niche-packed Expected, placed OFFSET bytes into the carrier.
+	 */
+	template<class Other, std::size_t OFFSET>
+	struct Niche_Placed
+	{
+		unsigned char padding[OFFSET];
+		Other object;
+		constexpr Niche_Placed() noexcept : padding() {}
+	};
+
+	template<class Other>
+	struct Niche_Placed<Other, 0>
+	{
+		Other object;
+		constexpr Niche_Placed() noexcept {}
+	};
+
+
+	/**
+	 * @brief Niche-packed Expected layout: the discriminant lives in spare bit patterns of one alternative (the carrier, see Niche_Traits).
+	 *        The storage is exactly the carrier's size. While the other alternative is active its object sits in the carrier's bytes around the tag.
+	 *        Both live in a union so that the defaulted copy of Expected copies the whole object representation, tag included.
+	 *
+	 * @tparam IN_VALUE true when T is the carrier, false when E is.
+	 */
+	template<class T, class E, bool IN_VALUE>
+	struct Expected_Niche_Storage
+	{
+		using Carrier = std::conditional_t<IN_VALUE, T, E>;
+		using Other = std::conditional_t<IN_VALUE, E, T>;
+		using Traits = Niche_Traits<Carrier>;
+		using Tag = typename Traits::Tag;
+		using Placed = Niche_Placed<Other, Niche_Other_Offset<Carrier, Other>()>;
+		static constexpr Expected_Active CARRIER_ACTIVE = IN_VALUE ? Expected_Active::Value : Expected_Active::Error;
+		static constexpr Expected_Active OTHER_ACTIVE = IN_VALUE ? Expected_Active::Error : Expected_Active::Value;
+
+		union Storage
+		{
+			struct Empty {} empty; // active in constant evaluation while neither alternative is
+			Carrier carrier;
+			Placed placed;
+			constexpr Storage() noexcept : empty() {}
+		} m_union;
+
+		static_assert(sizeof(Storage) == sizeof(Carrier), "the other alternative must fit in the carrier");
+
+		Tag Read_Tag() const noexcept
+		{
+			Tag tag;
+			std::memcpy(&tag, reinterpret_cast<const unsigned char*>(&m_union) + Traits::TAG_OFFSET, sizeof(Tag));
+			return tag;
+		}
+
+		void Write_Tag(Tag tag) noexcept { std::memcpy(reinterpret_cast<unsigned char*>(&m_union) + Traits::TAG_OFFSET, &tag, sizeof(Tag)); }
+
+		constexpr Expected_Active State() const noexcept
+		{
+#if O_UTILS_CONSTEXPR_NICHE
+			// no object representation in constant evaluation: the member alive is the state
+			if consteval
+			{
+				if (std::is_within_lifetime(&m_union.carrier)) return CARRIER_ACTIVE;
+				return std::is_within_lifetime(&m_union.placed) ? OTHER_ACTIVE : Expected_Active::None;
+			}
+#endif
+			const Tag tag = Read_Tag();
+			if (tag == Traits::FIRST_SPARE_TAG) return Expected_Active::None;
+			if (tag == Traits::SECOND_SPARE_TAG) return OTHER_ACTIVE;
+			return CARRIER_ACTIVE;
+		}
+
+		// the carrier object already wrote its own valid tag: only the two spare states are stored
+		constexpr void Set_State(Expected_Active active) noexcept
+		{
+#if O_UTILS_CONSTEXPR_NICHE
+			if consteval
+			{
+				if (active == Expected_Active::None)
+					std::construct_at(&m_union.empty);
+				return;
+			}
+#endif
+			if (active == Expected_Active::None)
+				Write_Tag(Traits::FIRST_SPARE_TAG);
+			else if (active == OTHER_ACTIVE)
+				Write_Tag(Traits::SECOND_SPARE_TAG);
+			else
+				assert(State() == CARRIER_ACTIVE && "value collides with a spare niche representation");
+		}
+
+		constexpr Carrier& Carrier_Ref() noexcept { return m_union.carrier; }
+		constexpr const Carrier& Carrier_Ref() const noexcept { return m_union.carrier; }
+		constexpr Other& Other_Ref() noexcept
+		{
+#if O_UTILS_CONSTEXPR_NICHE
+			// the other object is built inside placed: begin placed's lifetime first
+			if consteval
+			{
+				if (!std::is_within_lifetime(&m_union.placed))
+					std::construct_at(&m_union.placed);
+			}
+#endif
+			return m_union.placed.object;
+		}
+		constexpr const Other& Other_Ref() const noexcept { return m_union.placed.object; }
+
+		constexpr T& Value() noexcept { if constexpr (IN_VALUE) return Carrier_Ref(); else return Other_Ref(); }
+		constexpr const T& Value() const noexcept { if constexpr (IN_VALUE) return Carrier_Ref(); else return Other_Ref(); }
+		constexpr E& Error() noexcept { if constexpr (IN_VALUE) return Other_Ref(); else return Carrier_Ref(); }
+		constexpr const E& Error() const noexcept { if constexpr (IN_VALUE) return Other_Ref(); else return Carrier_Ref(); }
+	};
+
+
+	/**
+	 * @brief Layout picked by Expected: niche-packed in T, else niche-packed in E, else tagged.
+	 *        Niche packing is only used for Trivial_Payload alternatives.
+	 */
+	template<class T, class E>
+	using Expected_Storage_t =
+		std::conditional_t<Trivial_Payload<T, E> && Niche_Fits<T, E>, Expected_Niche_Storage<T, E, true>,
+		std::conditional_t<Trivial_Payload<T, E> && Niche_Fits<E, T>, Expected_Niche_Storage<T, E, false>,
+		Expected_Tagged_Storage<T, E>>>;
+
+
 	/// Tag type to construct an error explicitly
 	struct Error_Tag_t { explicit constexpr Error_Tag_t() = default; };
 	inline constexpr Error_Tag_t error_tag{};
 
+	// internal tags: construct the value (resp. error) in place from the result of a callable
+	struct Invoke_Value_Tag_t {};
+	struct Invoke_Error_Tag_t {};
+	// internal tag: construct an empty coroutine return object and register its address (see expected_coroutine.h)
+	struct Coroutine_Link_Tag_t {};
+
+	template<class T, class E> class Expected_Promise_Base;
+
+	/// Placeholder value stored by `Expected<void, E>`
+	struct Expected_Unit {};
+
+
+	/**
+	 * @brief Shared implementation of the monadic combinators of every Expected form.
+	 *
+	 * Each form provides, privately:
+	 *  - `Invoke_Value(self, f)`: calls f with the forwarded value (with nothing for `Expected<void, E>`)
+	 *  - `Forward_Error(self)`: the error, moved out when self is an rvalue
+	 *  - `Pass_Value<Result>(self)`: a Result holding the forwarded value
+	 */
+	struct Expected_Combinators
+	{
+		template<typename Self, typename F> static constexpr auto And_Then(Self&& self, F&& f);
+		template<typename Self, typename F> static constexpr auto Transform(Self&& self, F&& f);
+		template<typename Self, typename F> static constexpr auto Or_Else(Self&& self, F&& f);
+		template<typename Self, typename F> static constexpr auto Transform_Error(Self&& self, F&& f);
+	};
+
 	/**
 	 * @brief A simple "expected" type representing either a value (T) or an error (E).
 	 *
-	 * The type is move-only and stores either a value or an error in-place using a trivial union. Construction, destruction and moves are performed manually.
+	 * The type stores either a value or an error in-place using a trivial union. Construction, destruction, copies and moves are performed manually.
+	 * It is copyable when both T and E are (Copyable_Payload), move-only otherwise.
+	 * When both are trivially copyable and destructible (Trivial_Payload) every special member is defaulted instead:
+	 * Expected is then trivially copyable, `Expected<double, Err>` comes back from a call in registers, and a moved-from instance keeps its content.
+	 * Such payloads are also niche-packed when Niche_Traits allows it: `Expected<Point*, Err>` takes 8 bytes instead of 16.
+	 * `Expected<void, E>` and `Expected<T&, E>` are specialized below.
+	 * Everything is constexpr. Niche-packed instantiations are usable in constant evaluation when O_UTILS_CONSTEXPR_NICHE is 1.
 	 *
-	 * @tparam T Value type (must not be a reference)
+	 * @tparam T Value type (must not be an rvalue reference)
 	 * @tparam E Error type (must not be a reference)
 	 *
 	 * @note All non-trivial member functions are defined out-of-class in the accompanying header implementation file `expected.hpp`.
@@ -43,33 +291,44 @@ namespace O
 		static_assert(!std::is_reference_v<E>, "E must not be a reference");
 
 	public:
-		// Move-only
-		Expected(const Expected&) = delete;
-		Expected& operator=(const Expected&) = delete;
+		using Value_Type = T;
+		using Error_Type = E;
 
 		/** @name Construction / destruction */
 		/**@{*/
 		constexpr Expected() noexcept;
-		~Expected() noexcept;
-		Expected(Expected&& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>);
-		Expected& operator=(Expected&& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>);
+		constexpr ~Expected() noexcept requires Trivial_Payload<T, E> = default;
+		constexpr ~Expected() noexcept;
+		constexpr Expected(const Expected& other) requires Trivial_Payload<T, E> = default;
+		constexpr Expected(const Expected& other) requires Copyable_Payload<T, E>;
+		constexpr Expected(Expected&& other) noexcept requires Trivial_Payload<T, E> = default;
+		constexpr Expected(Expected&& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>);
+		constexpr Expected& operator=(const Expected& other) requires Trivial_Payload<T, E> = default;
+		constexpr Expected& operator=(const Expected& other) requires Copyable_Payload<T, E>;
+		constexpr Expected& operator=(Expected&& other) noexcept requires Trivial_Payload<T, E> = default;
+		constexpr Expected& operator=(Expected&& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>);
 		/**@}*/
 
 		/** @name Value / Error construction helpers */
 		/**@{*/
 		template <typename U>
-		requires std::constructible_from<T, U&&>
-		Expected(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>);
+		requires Not_Expected<U> && std::constructible_from<T, U&&>
+		constexpr Expected(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>);
 		template <typename U>
-		requires std::constructible_from<E, U&&> && (!std::constructible_from<T, U&&>)
-		Expected(U&& err) noexcept(std::is_nothrow_constructible_v<E, U&&>);
+		requires Not_Expected<U> && std::constructible_from<E, U&&> && (!std::constructible_from<T, U&&>)
+		constexpr Expected(U&& err) noexcept(std::is_nothrow_constructible_v<E, U&&>);
 
 		// In-place factories
 		template<typename... Args>
-		static Expected Make_Value(Args&&... args);
+		static constexpr Expected Make_Value(Args&&... args);
+
+		template<typename... Args>
+		static constexpr Expected Make_Error(Args&&... args);
 
+		// In-place error construction, unambiguous even when T and E are alike
 		template<typename... Args>
-		static Expected Make_Error(Args&&... args);
+		requires std::constructible_from<E, Args&&...>
+		explicit constexpr Expected(Error_Tag_t, Args&&... args) noexcept(std::is_nothrow_constructible_v<E, Args&&...>);
 		/**@}*/
 
 		/** @name State queries */
@@ -81,52 +340,313 @@ namespace O
 
 		/** @name Accessors (ref-qualified) */
 		/**@{*/
-		T& Value() &;
-		const T& Value() const &;
-		T&& Value() &&;
+		constexpr T& Value() &;
+		constexpr const T& Value() const &;
+		constexpr T&& Value() &&;
 
-		E& Error() &;
-		const E& Error() const &;
-		E&& Error() &&;
+		constexpr E& Error() &;
+		constexpr const E& Error() const &;
+		constexpr E&& Error() &&;
 		/**@}*/
 
 		/** @name Emplace / modifiers */
 		/**@{*/
 		template<typename... Args>
-		void Emplace_Value(Args&&... args);
+		constexpr void Emplace_Value(Args&&... args);
 
 		template<typename... Args>
-		void Emplace_Error(Args&&... args);
+		constexpr void Emplace_Error(Args&&... args);
 
-		void Swap(Expected& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>);
+		constexpr void Swap(Expected& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>);
+		/**@}*/
+
+		/**
+		 * @name Monadic combinators
+		 * The payload is handed to the next stage without going through Value() / Error(): no check, no throw.
+		 * On an rvalue Expected the payload is moved, and the result of `f` is constructed in place in the returned Expected,
+		 * so a stage costs at most one move of its payload. An empty Expected stays empty.
+		 */
+		/**@{*/
+		/// Calls `f(value)`, which returns an `Expected<U, E>`, or propagates the error.
+		template<typename F> requires std::invocable<F, T&> constexpr auto And_Then(F&& f) &;
+		template<typename F> requires std::invocable<F, const T&> constexpr auto And_Then(F&& f) const &;
+		template<typename F> requires std::invocable<F, T&&> constexpr auto And_Then(F&& f) &&;
+
+		/// Returns `Expected<U, E>` holding `f(value)`, or the propagated error. `Expected<void, E>` when f returns nothing.
+		template<typename F> requires std::invocable<F, T&> constexpr auto Transform(F&& f) &;
+		template<typename F> requires std::invocable<F, const T&> constexpr auto Transform(F&& f) const &;
+		template<typename F> requires std::invocable<F, T&&> constexpr auto Transform(F&& f) &&;
+
+		/// Calls `f(error)`, which returns an `Expected<T, G>`, or propagates the value.
+		template<typename F> requires std::invocable<F, E&> constexpr auto Or_Else(F&& f) &;
+		template<typename F> requires std::invocable<F, const E&> constexpr auto Or_Else(F&& f) const &;
+		template<typename F> requires std::invocable<F, E&&> constexpr auto Or_Else(F&& f) &&;
+
+		/// Returns `Expected<T, G>` holding `f(error)`, or the propagated value.
+		template<typename F> requires std::invocable<F, E&> constexpr auto Transform_Error(F&& f) &;
+		template<typename F> requires std::invocable<F, const E&> constexpr auto Transform_Error(F&& f) const &;
+		template<typename F> requires std::invocable<F, E&&> constexpr auto Transform_Error(F&& f) &&;
+
+		/// Returns the value, or `fallback` converted to T when there is none.
+		template<typename U> requires std::copy_constructible<T> && std::convertible_to<U&&, T> constexpr T Value_Or(U&& fallback) const &;
+		template<typename U> requires std::move_constructible<T> && std::convertible_to<U&&, T> constexpr T Value_Or(U&& fallback) &&;
 		/**@}*/
 
 	private:
-		enum class Active : unsigned char { None = 0, Value = 1, Error = 2 };
+		template<class, class> friend class Expected;
+		template<class, class> friend class Expected_Promise_Base;
+		friend struct Expected_Combinators;
 
-		union Storage
-		{
-			T value;
-			E error;
-			constexpr Storage() noexcept {}
-			~Storage() noexcept {}
-		} m_storage;
+		using Active = Expected_Active;
+
+		Expected_Storage_t<T, E> m_storage;
+
+		// construct the value (resp. error) in place from the result of a callable, used by the combinators
+		template<typename F, typename... Args>
+		constexpr Expected(Invoke_Value_Tag_t, F&& f, Args&&... args);
+		template<typename F, typename... Args>
+		constexpr Expected(Invoke_Error_Tag_t, F&& f, Args&&... args);
 
-		Active m_active;
+		constexpr Expected(Coroutine_Link_Tag_t, Expected*& link) noexcept;
+
+		// the stored payload, moved out when Self is an rvalue
+		template<typename Self> static constexpr decltype(auto) Forward_Value(Self&& self) noexcept;
+		template<typename Self> static constexpr decltype(auto) Forward_Error(Self&& self) noexcept;
+
+		// Expected_Combinators hooks
+		template<typename Self, typename F> static constexpr decltype(auto) Invoke_Value(Self&& self, F&& f);
+		template<typename Result, typename Self> static constexpr Result Pass_Value(Self&& self);
 
 		/** @name Internal helpers */
 		/**@{*/
-		void Destroy() noexcept;
-		void Move_From(Expected&& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>);
+		constexpr void Destroy() noexcept;
+		constexpr void Move_From(Expected&& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>);
+		constexpr void Copy_From(const Expected& other);
+
+		// out-of-line throw so that the accessors stay small enough to be inlined
+		[[noreturn]] static void Throw_Bad_Access(const char* what);
 
 		// pointer-like accessors (non-throwing)
-		T& Value_Ptr() noexcept;
-		const T& Value_Ptr() const noexcept;
-		E& Error_Ptr() noexcept;
-		const E& Error_Ptr() const noexcept;
+		constexpr T& Value_Ptr() noexcept;
+		constexpr const T& Value_Ptr() const noexcept;
+		constexpr E& Error_Ptr() noexcept;
+		constexpr const E& Error_Ptr() const noexcept;
 		/**@}*/
 	};
 
+
+
+	/**
+	 * @brief Expected for operations without a result: only the discriminant and E are stored.
+	 *
+	 * A success is built with Make_Value() or Emplace_Value(), an error from E as in the primary template.
+	 * It is a thin layer over `Expected<Expected_Unit, E>` and shares its copy, triviality and niche packing rules.
+	 *
+	 * @tparam E Error type (must not be a reference)
+	 */
+	template<class E>
+	class Expected<void, E>
+	{
+		static_assert(!std::is_reference_v<E>, "E must not be a reference");
+
+		using Base = Expected<Expected_Unit, E>;
+
+	public:
+		using Value_Type = void;
+		using Error_Type = E;
+
+		/** @name Construction */
+		/**@{*/
+		constexpr Expected() noexcept = default;
+
+		template <typename U>
+		requires Not_Expected<U> && std::constructible_from<E, U&&>
+		constexpr Expected(U&& err) noexcept(std::is_nothrow_constructible_v<E, U&&>);
+
+		template<typename... Args>
+		requires std::constructible_from<E, Args&&...>
+		explicit constexpr Expected(Error_Tag_t, Args&&... args) noexcept(std::is_nothrow_constructible_v<E, Args&&...>);
+
+		static constexpr Expected Make_Value() noexcept;
+
+		template<typename... Args>
+		static constexpr Expected Make_Error(Args&&... args);
+		/**@}*/
+
+		/** @name State queries */
+		/**@{*/
+		constexpr bool Has_Value() const noexcept;
+		constexpr bool Has_Error() const noexcept;
+		explicit constexpr operator bool() const noexcept;
+		/**@}*/
+
+		/** @name Accessors */
+		/**@{*/
+		/// Throws bad_expected_access when there is no value
+		constexpr void Value() const;
+
+		constexpr E& Error() &;
+		constexpr const E& Error() const &;
+		constexpr E&& Error() &&;
+		/**@}*/
+
+		/** @name Emplace / modifiers */
+		/**@{*/
+		constexpr void Emplace_Value() noexcept;
+
+		template<typename... Args>
+		constexpr void Emplace_Error(Args&&... args);
+
+		constexpr void Swap(Expected& other) noexcept(std::is_nothrow_move_constructible_v<E>);
+		/**@}*/
+
+		/** @name Monadic combinators (see the primary template), f takes no argument on the value side */
+		/**@{*/
+		template<typename F> requires std::invocable<F> constexpr auto And_Then(F&& f) &;
+		template<typename F> requires std::invocable<F> constexpr auto And_Then(F&& f) const &;
+		template<typename F> requires std::invocable<F> constexpr auto And_Then(F&& f) &&;
+
+		template<typename F> requires std::invocable<F> constexpr auto Transform(F&& f) &;
+		template<typename F> requires std::invocable<F> constexpr auto Transform(F&& f) const &;
+		template<typename F> requires std::invocable<F> constexpr auto Transform(F&& f) &&;
+
+		template<typename F> requires std::invocable<F, E&> constexpr auto Or_Else(F&& f) &;
+		template<typename F> requires std::invocable<F, const E&> constexpr auto Or_Else(F&& f) const &;
+		template<typename F> requires std::invocable<F, E&&> constexpr auto Or_Else(F&& f) &&;
+
+		template<typename F> requires std::invocable<F, E&> constexpr auto Transform_Error(F&& f) &;
+		template<typename F> requires std::invocable<F, const E&> constexpr auto Transform_Error(F&& f) const &;
+		template<typename F> requires std::invocable<F, E&&> constexpr auto Transform_Error(F&& f) &&;
+		/**@}*/
+
+	private:
+		template<class, class> friend class Expected;
+		template<class, class> friend class Expected_Promise_Base;
+		friend struct Expected_Combinators;
+
+		Base m_base;
+
+		template<typename F, typename... Args>
+		constexpr Expected(Invoke_Error_Tag_t, F&& f, Args&&... args);
+
+		constexpr Expected(Coroutine_Link_Tag_t, Expected*& link) noexcept;
+
+		// Expected_Combinators hooks
+		template<typename Self, typename F> static constexpr decltype(auto) Invoke_Value(Self&& self, F&& f);
+		template<typename Self> static constexpr decltype(auto) Forward_Error(Self&& self) noexcept;
+		template<typename Result, typename Self> static constexpr Result Pass_Value(Self&& self);
+	};
+
+
+	/**
+	 * @brief Expected holding a reference: a lookup returns the element it found without copying it.
+	 *
+	 * The reference is stored as a `T*` (`Expected<T*, E>` underneath, so it is niche-packed with a trivial E).
+	 * Like a pointer, constness is shallow: Value() returns `T&` on a const Expected. Binding a temporary is rejected.
+	 *
+	 * @tparam T Referenced type
+	 * @tparam E Error type (must not be a reference)
+	 */
+	template<class T, class E>
+	class Expected<T&, E>
+	{
+		static_assert(!std::is_reference_v<E>, "E must not be a reference");
+
+		using Base = Expected<T*, E>;
+
+	public:
+		using Value_Type = T&;
+		using Error_Type = E;
+
+		/** @name Construction */
+		/**@{*/
+		constexpr Expected() noexcept = default;
+
+		template <typename U>
+		requires Not_Expected<U> && std::convertible_to<U&, T&>
+		constexpr Expected(U& ref) noexcept;
+
+		template <typename U>
+		requires Not_Expected<U> && std::constructible_from<E, U&&> && (!std::convertible_to<U&&, T&>)
+		constexpr Expected(U&& err) noexcept(std::is_nothrow_constructible_v<E, U&&>);
+
+		template<typename... Args>
+		requires std::constructible_from<E, Args&&...>
+		explicit constexpr Expected(Error_Tag_t, Args&&... args) noexcept(std::is_nothrow_constructible_v<E, Args&&...>);
+
+		static constexpr Expected Make_Value(T& ref) noexcept;
+
+		template<typename... Args>
+		static constexpr Expected Make_Error(Args&&... args);
+		/**@}*/
+
+		/** @name State queries */
+		/**@{*/
+		constexpr bool Has_Value() const noexcept;
+		constexpr bool Has_Error() const noexcept;
+		explicit constexpr operator bool() const noexcept;
+		/**@}*/
+
+		/** @name Accessors */
+		/**@{*/
+		constexpr T& Value() const;
+		constexpr T& Value_Or(T& fallback) const noexcept;
+
+		constexpr E& Error() &;
+		constexpr const E& Error() const &;
+		constexpr E&& Error() &&;
+		/**@}*/
+
+		/** @name Emplace / modifiers */
+		/**@{*/
+		/// Rebinds the reference
+		constexpr void Emplace_Value(T& ref) noexcept;
+
+		template<typename... Args>
+		constexpr void Emplace_Error(Args&&... args);
+
+		constexpr void Swap(Expected& other) noexcept(std::is_nothrow_move_constructible_v<E>);
+		/**@}*/
+
+		/** @name Monadic combinators (see the primary template), f always receives `T&` */
+		/**@{*/
+		template<typename F> requires std::invocable<F, T&> constexpr auto And_Then(F&& f) &;
+		template<typename F> requires std::invocable<F, T&> constexpr auto And_Then(F&& f) const &;
+		template<typename F> requires std::invocable<F, T&> constexpr auto And_Then(F&& f) &&;
+
+		template<typename F> requires std::invocable<F, T&> constexpr auto Transform(F&& f) &;
+		template<typename F> requires std::invocable<F, T&> constexpr auto Transform(F&& f) const &;
+		template<typename F> requires std::invocable<F, T&> constexpr auto Transform(F&& f) &&;
+
+		template<typename F> requires std::invocable<F, E&> constexpr auto Or_Else(F&& f) &;
+		template<typename F> requires std::invocable<F, const E&> constexpr auto Or_Else(F&& f) const &;
+		template<typename F> requires std::invocable<F, E&&> constexpr auto Or_Else(F&& f) &&;
+
+		template<typename F> requires std::invocable<F, E&> constexpr auto Transform_Error(F&& f) &;
+		template<typename F> requires std::invocable<F, const E&> constexpr auto Transform_Error(F&& f) const &;
+		template<typename F> requires std::invocable<F, E&&> constexpr auto Transform_Error(F&& f) &&;
+		/**@}*/
+
+	private:
+		template<class, class> friend class Expected;
+		template<class, class> friend class Expected_Promise_Base;
+		friend struct Expected_Combinators;
+
+		Base m_base;
+
+		template<typename F, typename... Args>
+		constexpr Expected(Invoke_Error_Tag_t, F&& f, Args&&... args);
+
+		constexpr Expected(Coroutine_Link_Tag_t, Expected*& link) noexcept;
+
+		constexpr T& Ref() const noexcept;
+
+		// Expected_Combinators hooks
+		template<typename Self, typename F> static constexpr decltype(auto) Invoke_Value(Self&& self, F&& f);
+		template<typename Self> static constexpr decltype(auto) Forward_Error(Self&& self) noexcept;
+		template<typename Result, typename Self> static constexpr Result Pass_Value(Self&& self);
+	};
+
 } // namespace O
 
 #include "expected.hpp"
@@ -8,19 +8,36 @@ namespace O
 
 	// --- Construction / destruction ---
 	template<class T, class E>
-	constexpr Expected<T, E>::Expected() noexcept : m_active(Active::None) {}
+	constexpr Expected<T, E>::Expected() noexcept { m_storage.Set_State(Active::None); }
 
 	template<class T, class E>
-	Expected<T, E>::~Expected() noexcept { Destroy(); }
+	constexpr Expected<T, E>::~Expected() noexcept { Destroy(); }
 
 	template<class T, class E>
-	Expected<T, E>::Expected(Expected&& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>) : m_active(Active::None)
+	constexpr Expected<T, E>::Expected(Expected&& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>)
 	{
+		m_storage.Set_State(Active::None);
 		Move_From(std::move(other));
 	}
 
 	template<class T, class E>
-	Expected<T, E>& Expected<T, E>::operator=(Expected&& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>)
+	constexpr Expected<T, E>::Expected(const Expected& other) requires Copyable_Payload<T, E>
+	{
+		m_storage.Set_State(Active::None);
+		Copy_From(other);
+	}
+
+	template<class T, class E>
+	constexpr Expected<T, E>& Expected<T, E>::operator=(const Expected& other) requires Copyable_Payload<T, E>
+	{
+		if (this == &other) return *this;
+		Destroy();
+		Copy_From(other);
+		return *this;
+	}
+
+	template<class T, class E>
+	constexpr Expected<T, E>& Expected<T, E>::operator=(Expected&& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>)
 	{
 		if (this == &other) return *this;
 		Destroy();
@@ -31,26 +48,26 @@ namespace O
 	// --- Value / Error ctor templates ---
 	template<class T, class E>
 	template<typename U>
-	requires std::constructible_from<T, U&&>
-	Expected<T, E>::Expected(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>)
+	requires Not_Expected<U> && std::constructible_from<T, U&&>
+	constexpr Expected<T, E>::Expected(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>)
 	{
-		new (&m_storage.value) T(std::forward<U>(value));
-		m_active = Active::Value;
+		std::construct_at(std::addressof(m_storage.Value()), std::forward<U>(value));
+		m_storage.Set_State(Active::Value);
 	}
 
 	template<class T, class E>
 	template<typename U>
-	requires std::constructible_from<E, U&&> && (!std::constructible_from<T, U&&>)
-	Expected<T, E>::Expected(U&& err) noexcept(std::is_nothrow_constructible_v<E, U&&>)
+	requires Not_Expected<U> && std::constructible_from<E, U&&> && (!std::constructible_from<T, U&&>)
+	constexpr Expected<T, E>::Expected(U&& err) noexcept(std::is_nothrow_constructible_v<E, U&&>)
 	{
-		new (&m_storage.error) E(std::forward<U>(err));
-		m_active = Active::Error;
+		std::construct_at(std::addressof(m_storage.Error()), std::forward<U>(err));
+		m_storage.Set_State(Active::Error);
 	}
 
 	// --- In-place factories ---
 	template<class T, class E>
 	template<typename... Args>
-	Expected<T, E> Expected<T, E>::Make_Value(Args&&... args)
+	constexpr Expected<T, E> Expected<T, E>::Make_Value(Args&&... args)
 	{
 		Expected out;
 		out.Emplace_Value(std::forward<Args>(args)...);
@@ -59,87 +76,128 @@ namespace O
 
 	template<class T, class E>
 	template<typename... Args>
-	Expected<T, E> Expected<T, E>::Make_Error(Args&&... args)
+	constexpr Expected<T, E> Expected<T, E>::Make_Error(Args&&... args)
 	{
 		Expected out;
 		out.Emplace_Error(std::forward<Args>(args)...);
 		return out;
 	}
 
+	template<class T, class E>
+	template<typename... Args>
+	requires std::constructible_from<E, Args&&...>
+	constexpr Expected<T, E>::Expected(Error_Tag_t, Args&&... args) noexcept(std::is_nothrow_constructible_v<E, Args&&...>)
+	{
+		std::construct_at(std::addressof(m_storage.Error()), std::forward<Args>(args)...);
+		m_storage.Set_State(Active::Error);
+	}
+
+	template<class T, class E>
+	template<typename F, typename... Args>
+	constexpr Expected<T, E>::Expected(Invoke_Value_Tag_t, F&& f, Args&&... args)
+	{
+		// the prvalue returned by std::invoke initializes the storage directly at run time (construct_at, needed in constant evaluation, would move it once)
+		if (std::is_constant_evaluated())
+		{
+			if constexpr (std::move_constructible<T>)
+				std::construct_at(std::addressof(m_storage.Value()), std::invoke(std::forward<F>(f), std::forward<Args>(args)...));
+		}
+		else
+			::new (static_cast<void*>(std::addressof(m_storage.Value()))) T(std::invoke(std::forward<F>(f), std::forward<Args>(args)...));
+		m_storage.Set_State(Active::Value);
+	}
+
+	template<class T, class E>
+	template<typename F, typename... Args>
+	constexpr Expected<T, E>::Expected(Invoke_Error_Tag_t, F&& f, Args&&... args)
+	{
+		if (std::is_constant_evaluated())
+		{
+			if constexpr (std::move_constructible<E>)
+				std::construct_at(std::addressof(m_storage.Error()), std::invoke(std::forward<F>(f), std::forward<Args>(args)...));
+		}
+		else
+			::new (static_cast<void*>(std::addressof(m_storage.Error()))) E(std::invoke(std::forward<F>(f), std::forward<Args>(args)...));
+		m_storage.Set_State(Active::Error);
+	}
+
+	template<class T, class E>
+	constexpr Expected<T, E>::Expected(Coroutine_Link_Tag_t, Expected*& link) noexcept : Expected() { link = this; }
+
 	// --- Queries ---
 	template<class T, class E>
-	constexpr bool Expected<T, E>::Has_Value() const noexcept { return m_active == Active::Value; }
+	constexpr bool Expected<T, E>::Has_Value() const noexcept { return m_storage.State() == Active::Value; }
 
 	template<class T, class E>
-	constexpr bool Expected<T, E>::Has_Error() const noexcept { return m_active == Active::Error; }
+	constexpr bool Expected<T, E>::Has_Error() const noexcept { return m_storage.State() == Active::Error; }
 
 	template<class T, class E>
 	constexpr Expected<T, E>::operator bool() const noexcept { return Has_Value(); }
 
 	// --- Accessors ---
 	template<class T, class E>
-	T& Expected<T, E>::Value() &
+	constexpr T& Expected<T, E>::Value() &
 	{
-		if (!Has_Value()) throw bad_expected_access("no value");
+		if (!Has_Value()) Throw_Bad_Access("no value");
 		return Value_Ptr();
 	}
 
 	template<class T, class E>
-	const T& Expected<T, E>::Value() const &
+	constexpr const T& Expected<T, E>::Value() const &
 	{
-		if (!Has_Value()) throw bad_expected_access("no value");
+		if (!Has_Value()) Throw_Bad_Access("no value");
 		return Value_Ptr();
 	}
 
 	template<class T, class E>
-	T&& Expected<T, E>::Value() &&
+	constexpr T&& Expected<T, E>::Value() &&
 	{
-		if (!Has_Value()) throw bad_expected_access("no value");
+		if (!Has_Value()) Throw_Bad_Access("no value");
 		return std::move(Value_Ptr());
 	}
 
 	template<class T, class E>
-	E& Expected<T, E>::Error() &
+	constexpr E& Expected<T, E>::Error() &
 	{
-		if (!Has_Error()) throw bad_expected_access("no error");
+		if (!Has_Error()) Throw_Bad_Access("no error");
 		return Error_Ptr();
 	}
 
 	template<class T, class E>
-	const E& Expected<T, E>::Error() const &
+	constexpr const E& Expected<T, E>::Error() const &
 	{
-		if (!Has_Error()) throw bad_expected_access("no error");
+		if (!Has_Error()) Throw_Bad_Access("no error");
 		return Error_Ptr();
 	}
 
 	template<class T, class E>
-	E&& Expected<T, E>::Error() &&
+	constexpr E&& Expected<T, E>::Error() &&
 	{
-		if (!Has_Error()) throw bad_expected_access("no error");
+		if (!Has_Error()) Throw_Bad_Access("no error");
 		return std::move(Error_Ptr());
 	}
 
 	// --- Emplace / modifiers ---
 	template<class T, class E>
 	template<typename... Args>
-	void Expected<T, E>::Emplace_Value(Args&&... args)
+	constexpr void Expected<T, E>::Emplace_Value(Args&&... args)
 	{
 		Destroy();
-		new (&m_storage.value) T(std::forward<Args>(args)...);
-		m_active = Active::Value;
+		std::construct_at(std::addressof(m_storage.Value()), std::forward<Args>(args)...);
+		m_storage.Set_State(Active::Value);
 	}
 
 	template<class T, class E>
 	template<typename... Args>
-	void Expected<T, E>::Emplace_Error(Args&&... args)
+	constexpr void Expected<T, E>::Emplace_Error(Args&&... args)
 	{
 		Destroy();
-		new (&m_storage.error) E(std::forward<Args>(args)...);
-		m_active = Active::Error;
+		std::construct_at(std::addressof(m_storage.Error()), std::forward<Args>(args)...);
+		m_storage.Set_State(Active::Error);
 	}
 
 	template<class T, class E>
-	void Expected<T, E>::Swap(Expected& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>)
+	constexpr void Expected<T, E>::Swap(Expected& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>)
 	{
 		if (this == &other) return;
 		Expected tmp = std::move(other);
@@ -147,39 +205,509 @@ namespace O
 		*this = std::move(tmp);
 	}
 
+	// --- Monadic combinators ---
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, T&>
+	constexpr auto Expected<T, E>::And_Then(F&& f) & { return Expected_Combinators::And_Then(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, const T&>
+	constexpr auto Expected<T, E>::And_Then(F&& f) const & { return Expected_Combinators::And_Then(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, T&&>
+	constexpr auto Expected<T, E>::And_Then(F&& f) && { return Expected_Combinators::And_Then(std::move(*this), std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, T&>
+	constexpr auto Expected<T, E>::Transform(F&& f) & { return Expected_Combinators::Transform(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, const T&>
+	constexpr auto Expected<T, E>::Transform(F&& f) const & { return Expected_Combinators::Transform(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, T&&>
+	constexpr auto Expected<T, E>::Transform(F&& f) && { return Expected_Combinators::Transform(std::move(*this), std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, E&>
+	constexpr auto Expected<T, E>::Or_Else(F&& f) & { return Expected_Combinators::Or_Else(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, const E&>
+	constexpr auto Expected<T, E>::Or_Else(F&& f) const & { return Expected_Combinators::Or_Else(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, E&&>
+	constexpr auto Expected<T, E>::Or_Else(F&& f) && { return Expected_Combinators::Or_Else(std::move(*this), std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, E&>
+	constexpr auto Expected<T, E>::Transform_Error(F&& f) & { return Expected_Combinators::Transform_Error(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, const E&>
+	constexpr auto Expected<T, E>::Transform_Error(F&& f) const & { return Expected_Combinators::Transform_Error(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, E&&>
+	constexpr auto Expected<T, E>::Transform_Error(F&& f) && { return Expected_Combinators::Transform_Error(std::move(*this), std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename U> requires std::copy_constructible<T> && std::convertible_to<U&&, T>
+	constexpr T Expected<T, E>::Value_Or(U&& fallback) const &
+	{
+		if (Has_Value())
+			return Value_Ptr();
+		return static_cast<T>(std::forward<U>(fallback));
+	}
+
+	template<class T, class E>
+	template<typename U> requires std::move_constructible<T> && std::convertible_to<U&&, T>
+	constexpr T Expected<T, E>::Value_Or(U&& fallback) &&
+	{
+		if (Has_Value())
+			return std::move(Value_Ptr());
+		return static_cast<T>(std::forward<U>(fallback));
+	}
+
+	template<class T, class E>
+	template<typename Self>
+	constexpr decltype(auto) Expected<T, E>::Forward_Value(Self&& self) noexcept
+	{
+		if constexpr (std::is_lvalue_reference_v<Self>)
+			return self.Value_Ptr();
+		else
+			return std::move(self.Value_Ptr());
+	}
+
+	template<class T, class E>
+	template<typename Self>
+	constexpr decltype(auto) Expected<T, E>::Forward_Error(Self&& self) noexcept
+	{
+		if constexpr (std::is_lvalue_reference_v<Self>)
+			return self.Error_Ptr();
+		else
+			return std::move(self.Error_Ptr());
+	}
+
+	template<class T, class E>
+	template<typename Self, typename F>
+	constexpr decltype(auto) Expected<T, E>::Invoke_Value(Self&& self, F&& f)
+	{
+		return std::invoke(std::forward<F>(f), Forward_Value(std::forward<Self>(self)));
+	}
+
+	template<class T, class E>
+	template<typename Result, typename Self>
+	constexpr Result Expected<T, E>::Pass_Value(Self&& self)
+	{
+		return Result(Forward_Value(std::forward<Self>(self)));
+	}
+
 	// --- Internal helpers ---
 	template<class T, class E>
-	void Expected<T, E>::Destroy() noexcept
+	constexpr void Expected<T, E>::Destroy() noexcept
 	{
-		if (m_active == Active::Value)
-			m_storage.value.~T();
-		else if (m_active == Active::Error)
-			m_storage.error.~E();
-		m_active = Active::None;
+		const Active active = m_storage.State();
+		if (active == Active::Value)
+			std::destroy_at(std::addressof(m_storage.Value()));
+		else if (active == Active::Error)
+			std::destroy_at(std::addressof(m_storage.Error()));
+		m_storage.Set_State(Active::None);
 	}
 
 	template<class T, class E>
-	void Expected<T, E>::Move_From(Expected&& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>)
+	constexpr void Expected<T, E>::Move_From(Expected&& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>)
 	{
-		m_active = other.m_active;
-		if (other.m_active == Active::Value)
-			new (&m_storage.value) T(std::move(other.m_storage.value));
-		else if (other.m_active == Active::Error)
-			new (&m_storage.error) E(std::move(other.m_storage.error));
+		const Active active = other.m_storage.State();
+		if (active == Active::Value)
+			std::construct_at(std::addressof(m_storage.Value()), std::move(other.m_storage.Value()));
+		else if (active == Active::Error)
+			std::construct_at(std::addressof(m_storage.Error()), std::move(other.m_storage.Error()));
+		m_storage.Set_State(active);
 		other.Destroy();
 	}
 
 	template<class T, class E>
-	T& Expected<T, E>::Value_Ptr() noexcept { return m_storage.value; }
+	constexpr void Expected<T, E>::Copy_From(const Expected& other)
+	{
+		const Active active = other.m_storage.State();
+		if (active == Active::Value)
+			std::construct_at(std::addressof(m_storage.Value()), other.m_storage.Value());
+		else if (active == Active::Error)
+			std::construct_at(std::addressof(m_storage.Error()), other.m_storage.Error());
+		m_storage.Set_State(active);
+	}
+
+	template<class T, class E>
+	void Expected<T, E>::Throw_Bad_Access(const char* what)
+	{
+#if O_UTILS_HAS_EXCEPTIONS
+		throw bad_expected_access(what);
+#else
+		Terminate_On_Error(what);
+#endif
+	}
+
+	template<class T, class E>
+	constexpr T& Expected<T, E>::Value_Ptr() noexcept { return m_storage.Value(); }
+
+	template<class T, class E>
+	constexpr const T& Expected<T, E>::Value_Ptr() const noexcept { return m_storage.Value(); }
+
+	template<class T, class E>
+	constexpr E& Expected<T, E>::Error_Ptr() noexcept { return m_storage.Error(); }
+
+	template<class T, class E>
+	constexpr const E& Expected<T, E>::Error_Ptr() const noexcept { return m_storage.Error(); }
+
+	// --- Shared combinators ---
+	template<typename Self, typename F>
+	constexpr auto Expected_Combinators::And_Then(Self&& self, F&& f)
+	{
+		using X = std::remove_cvref_t<Self>;
+		using Result = std::remove_cvref_t<decltype(X::Invoke_Value(std::forward<Self>(self), std::forward<F>(f)))>;
+		static_assert(Is_Expected_v<Result>, "And_Then callable must return an O::Expected");
+
+		if (self.Has_Value())
+			return X::Invoke_Value(std::forward<Self>(self), std::forward<F>(f));
+		if (self.Has_Error())
+			return Result(error_tag, X::Forward_Error(std::forward<Self>(self)));
+		return Result();
+	}
+
+	template<typename Self, typename F>
+	constexpr auto Expected_Combinators::Transform(Self&& self, F&& f)
+	{
+		using X = std::remove_cvref_t<Self>;
+		using U = std::remove_cv_t<decltype(X::Invoke_Value(std::forward<Self>(self), std::forward<F>(f)))>;
+		static_assert(!std::is_reference_v<U>, "Transform callable must return an object or void");
+		using Result = Expected<U, typename X::Error_Type>;
+
+		if (self.Has_Value())
+		{
+			if constexpr (std::is_void_v<U>)
+			{
+				X::Invoke_Value(std::forward<Self>(self), std::forward<F>(f));
+				return Result::Make_Value();
+			}
+			else
+				return Result(Invoke_Value_Tag_t{}, [&]() -> U { return X::Invoke_Value(std::forward<Self>(self), std::forward<F>(f)); });
+		}
+		if (self.Has_Error())
+			return Result(error_tag, X::Forward_Error(std::forward<Self>(self)));
+		return Result();
+	}
+
+	template<typename Self, typename F>
+	constexpr auto Expected_Combinators::Or_Else(Self&& self, F&& f)
+	{
+		using X = std::remove_cvref_t<Self>;
+		using Result = std::remove_cvref_t<std::invoke_result_t<F, decltype(X::Forward_Error(std::forward<Self>(self)))>>;
+		static_assert(Is_Expected_v<Result>, "Or_Else callable must return an O::Expected");
+
+		if (self.Has_Error())
+			return std::invoke(std::forward<F>(f), X::Forward_Error(std::forward<Self>(self)));
+		if (self.Has_Value())
+			return X::template Pass_Value<Result>(std::forward<Self>(self));
+		return Result();
+	}
+
+	template<typename Self, typename F>
+	constexpr auto Expected_Combinators::Transform_Error(Self&& self, F&& f)
+	{
+		using X = std::remove_cvref_t<Self>;
+		using G = std::remove_cv_t<std::invoke_result_t<F, decltype(X::Forward_Error(std::forward<Self>(self)))>>;
+		static_assert(!std::is_void_v<G> && !std::is_reference_v<G>, "Transform_Error callable must return an object");
+		using Result = Expected<typename X::Value_Type, G>;
+
+		if (self.Has_Error())
+			return Result(Invoke_Error_Tag_t{}, std::forward<F>(f), X::Forward_Error(std::forward<Self>(self)));
+		if (self.Has_Value())
+			return X::template Pass_Value<Result>(std::forward<Self>(self));
+		return Result();
+	}
+
+	// --- Expected<void, E> ---
+	template<class E>
+	template<typename U>
+	requires Not_Expected<U> && std::constructible_from<E, U&&>
+	constexpr Expected<void, E>::Expected(U&& err) noexcept(std::is_nothrow_constructible_v<E, U&&>) : m_base(error_tag, std::forward<U>(err)) {}
+
+	template<class E>
+	template<typename... Args>
+	requires std::constructible_from<E, Args&&...>
+	constexpr Expected<void, E>::Expected(Error_Tag_t, Args&&... args) noexcept(std::is_nothrow_constructible_v<E, Args&&...>) : m_base(error_tag, std::forward<Args>(args)...) {}
+
+	template<class E>
+	template<typename F, typename... Args>
+	constexpr Expected<void, E>::Expected(Invoke_Error_Tag_t, F&& f, Args&&... args) : m_base(Invoke_Error_Tag_t{}, std::forward<F>(f), std::forward<Args>(args)...) {}
+
+	template<class E>
+	constexpr Expected<void, E>::Expected(Coroutine_Link_Tag_t, Expected*& link) noexcept { link = this; }
+
+	template<class E>
+	constexpr Expected<void, E> Expected<void, E>::Make_Value() noexcept
+	{
+		Expected out;
+		out.Emplace_Value();
+		return out;
+	}
+
+	template<class E>
+	template<typename... Args>
+	constexpr Expected<void, E> Expected<void, E>::Make_Error(Args&&... args)
+	{
+		Expected out;
+		out.Emplace_Error(std::forward<Args>(args)...);
+		return out;
+	}
+
+	template<class E>
+	constexpr bool Expected<void, E>::Has_Value() const noexcept { return m_base.Has_Value(); }
+
+	template<class E>
+	constexpr bool Expected<void, E>::Has_Error() const noexcept { return m_base.Has_Error(); }
+
+	template<class E>
+	constexpr Expected<void, E>::operator bool() const noexcept { return Has_Value(); }
+
+	template<class E>
+	constexpr void Expected<void, E>::Value() const
+	{
+		if (!Has_Value()) Base::Throw_Bad_Access("no value");
+	}
+
+	template<class E>
+	constexpr E& Expected<void, E>::Error() & { return m_base.Error(); }
+
+	template<class E>
+	constexpr const E& Expected<void, E>::Error() const & { return m_base.Error(); }
+
+	template<class E>
+	constexpr E&& Expected<void, E>::Error() && { return std::move(m_base).Error(); }
+
+	template<class E>
+	constexpr void Expected<void, E>::Emplace_Value() noexcept { m_base.Emplace_Value(); }
+
+	template<class E>
+	template<typename... Args>
+	constexpr void Expected<void, E>::Emplace_Error(Args&&... args) { m_base.Emplace_Error(std::forward<Args>(args)...); }
+
+	template<class E>
+	constexpr void Expected<void, E>::Swap(Expected& other) noexcept(std::is_nothrow_move_constructible_v<E>) { m_base.Swap(other.m_base); }
+
+	template<class E>
+	template<typename F> requires std::invocable<F>
+	constexpr auto Expected<void, E>::And_Then(F&& f) & { return Expected_Combinators::And_Then(*this, std::forward<F>(f)); }
+
+	template<class E>
+	template<typename F> requires std::invocable<F>
+	constexpr auto Expected<void, E>::And_Then(F&& f) const & { return Expected_Combinators::And_Then(*this, std::forward<F>(f)); }
+
+	template<class E>
+	template<typename F> requires std::invocable<F>
+	constexpr auto Expected<void, E>::And_Then(F&& f) && { return Expected_Combinators::And_Then(std::move(*this), std::forward<F>(f)); }
+
+	template<class E>
+	template<typename F> requires std::invocable<F>
+	constexpr auto Expected<void, E>::Transform(F&& f) & { return Expected_Combinators::Transform(*this, std::forward<F>(f)); }
+
+	template<class E>
+	template<typename F> requires std::invocable<F>
+	constexpr auto Expected<void, E>::Transform(F&& f) const & { return Expected_Combinators::Transform(*this, std::forward<F>(f)); }
+
+	template<class E>
+	template<typename F> requires std::invocable<F>
+	constexpr auto Expected<void, E>::Transform(F&& f) && { return Expected_Combinators::Transform(std::move(*this), std::forward<F>(f)); }
+
+	template<class E>
+	template<typename F> requires std::invocable<F, E&>
+	constexpr auto Expected<void, E>::Or_Else(F&& f) & { return Expected_Combinators::Or_Else(*this, std::forward<F>(f)); }
+
+	template<class E>
+	template<typename F> requires std::invocable<F, const E&>
+	constexpr auto Expected<void, E>::Or_Else(F&& f) const & { return Expected_Combinators::Or_Else(*this, std::forward<F>(f)); }
+
+	template<class E>
+	template<typename F> requires std::invocable<F, E&&>
+	constexpr auto Expected<void, E>::Or_Else(F&& f) && { return Expected_Combinators::Or_Else(std::move(*this), std::forward<F>(f)); }
+
+	template<class E>
+	template<typename F> requires std::invocable<F, E&>
+	constexpr auto Expected<void, E>::Transform_Error(F&& f) & { return Expected_Combinators::Transform_Error(*this, std::forward<F>(f)); }
+
+	template<class E>
+	template<typename F> requires std::invocable<F, const E&>
+	constexpr auto Expected<void, E>::Transform_Error(F&& f) const & { return Expected_Combinators::Transform_Error(*this, std::forward<F>(f)); }
+
+	template<class E>
+	template<typename F> requires std::invocable<F, E&&>
+	constexpr auto Expected<void, E>::Transform_Error(F&& f) && { return Expected_Combinators::Transform_Error(std::move(*this), std::forward<F>(f)); }
+
+	template<class E>
+	template<typename Self, typename F>
+	constexpr decltype(auto) Expected<void, E>::Invoke_Value(Self&&, F&& f)
+	{
+		return std::invoke(std::forward<F>(f));
+	}
+
+	template<class E>
+	template<typename Self>
+	constexpr decltype(auto) Expected<void, E>::Forward_Error(Self&& self) noexcept
+	{
+		return Base::Forward_Error(std::forward<Self>(self).m_base);
+	}
+
+	template<class E>
+	template<typename Result, typename Self>
+	constexpr Result Expected<void, E>::Pass_Value(Self&&)
+	{
+		return Result::Make_Value();
+	}
+
+	// --- Expected<T&, E> ---
+	template<class T, class E>
+	template<typename U>
+	requires Not_Expected<U> && std::convertible_to<U&, T&>
+	constexpr Expected<T&, E>::Expected(U& ref) noexcept : m_base(std::addressof(static_cast<T&>(ref))) {}
 
 	template<class T, class E>
-	const T& Expected<T, E>::Value_Ptr() const noexcept { return m_storage.value; }
+	template<typename U>
+	requires Not_Expected<U> && std::constructible_from<E, U&&> && (!std::convertible_to<U&&, T&>)
+	constexpr Expected<T&, E>::Expected(U&& err) noexcept(std::is_nothrow_constructible_v<E, U&&>) : m_base(error_tag, std::forward<U>(err)) {}
 
 	template<class T, class E>
-	E& Expected<T, E>::Error_Ptr() noexcept { return m_storage.error; }
+	template<typename... Args>
+	requires std::constructible_from<E, Args&&...>
+	constexpr Expected<T&, E>::Expected(Error_Tag_t, Args&&... args) noexcept(std::is_nothrow_constructible_v<E, Args&&...>) : m_base(error_tag, std::forward<Args>(args)...) {}
 
 	template<class T, class E>
-	const E& Expected<T, E>::Error_Ptr() const noexcept { return m_storage.error; }
+	template<typename F, typename... Args>
+	constexpr Expected<T&, E>::Expected(Invoke_Error_Tag_t, F&& f, Args&&... args) : m_base(Invoke_Error_Tag_t{}, std::forward<F>(f), std::forward<Args>(args)...) {}
+
+	template<class T, class E>
+	constexpr Expected<T&, E>::Expected(Coroutine_Link_Tag_t, Expected*& link) noexcept { link = this; }
+
+	template<class T, class E>
+	constexpr Expected<T&, E> Expected<T&, E>::Make_Value(T& ref) noexcept { return Expected(ref); }
+
+	template<class T, class E>
+	template<typename... Args>
+	constexpr Expected<T&, E> Expected<T&, E>::Make_Error(Args&&... args)
+	{
+		Expected out;
+		out.Emplace_Error(std::forward<Args>(args)...);
+		return out;
+	}
+
+	template<class T, class E>
+	constexpr bool Expected<T&, E>::Has_Value() const noexcept { return m_base.Has_Value(); }
+
+	template<class T, class E>
+	constexpr bool Expected<T&, E>::Has_Error() const noexcept { return m_base.Has_Error(); }
+
+	template<class T, class E>
+	constexpr Expected<T&, E>::operator bool() const noexcept { return Has_Value(); }
+
+	template<class T, class E>
+	constexpr T& Expected<T&, E>::Value() const { return *m_base.Value(); }
+
+	template<class T, class E>
+	constexpr T& Expected<T&, E>::Value_Or(T& fallback) const noexcept { return Has_Value() ? Ref() : fallback; }
+
+	template<class T, class E>
+	constexpr E& Expected<T&, E>::Error() & { return m_base.Error(); }
+
+	template<class T, class E>
+	constexpr const E& Expected<T&, E>::Error() const & { return m_base.Error(); }
+
+	template<class T, class E>
+	constexpr E&& Expected<T&, E>::Error() && { return std::move(m_base).Error(); }
+
+	template<class T, class E>
+	constexpr void Expected<T&, E>::Emplace_Value(T& ref) noexcept { m_base.Emplace_Value(std::addressof(ref)); }
+
+	template<class T, class E>
+	template<typename... Args>
+	constexpr void Expected<T&, E>::Emplace_Error(Args&&... args) { m_base.Emplace_Error(std::forward<Args>(args)...); }
+
+	template<class T, class E>
+	constexpr void Expected<T&, E>::Swap(Expected& other) noexcept(std::is_nothrow_move_constructible_v<E>) { m_base.Swap(other.m_base); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, T&>
+	constexpr auto Expected<T&, E>::And_Then(F&& f) & { return Expected_Combinators::And_Then(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, T&>
+	constexpr auto Expected<T&, E>::And_Then(F&& f) const & { return Expected_Combinators::And_Then(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, T&>
+	constexpr auto Expected<T&, E>::And_Then(F&& f) && { return Expected_Combinators::And_Then(std::move(*this), std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, T&>
+	constexpr auto Expected<T&, E>::Transform(F&& f) & { return Expected_Combinators::Transform(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, T&>
+	constexpr auto Expected<T&, E>::Transform(F&& f) const & { return Expected_Combinators::Transform(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, T&>
+	constexpr auto Expected<T&, E>::Transform(F&& f) && { return Expected_Combinators::Transform(std::move(*this), std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, E&>
+	constexpr auto Expected<T&, E>::Or_Else(F&& f) & { return Expected_Combinators::Or_Else(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, const E&>
+	constexpr auto Expected<T&, E>::Or_Else(F&& f) const & { return Expected_Combinators::Or_Else(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, E&&>
+	constexpr auto Expected<T&, E>::Or_Else(F&& f) && { return Expected_Combinators::Or_Else(std::move(*this), std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, E&>
+	constexpr auto Expected<T&, E>::Transform_Error(F&& f) & { return Expected_Combinators::Transform_Error(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, const E&>
+	constexpr auto Expected<T&, E>::Transform_Error(F&& f) const & { return Expected_Combinators::Transform_Error(*this, std::forward<F>(f)); }
+
+	template<class T, class E>
+	template<typename F> requires std::invocable<F, E&&>
+	constexpr auto Expected<T&, E>::Transform_Error(F&& f) && { return Expected_Combinators::Transform_Error(std::move(*this), std::forward<F>(f)); }
+
+	template<class T, class E>
+	constexpr T& Expected<T&, E>::Ref() const noexcept { return *m_base.Value_Ptr(); }
+
+	template<class T, class E>
+	template<typename Self, typename F>
+	constexpr decltype(auto) Expected<T&, E>::Invoke_Value(Self&& self, F&& f)
+	{
+		return std::invoke(std::forward<F>(f), self.Ref());
+	}
+
+	template<class T, class E>
+	template<typename Self>
+	constexpr decltype(auto) Expected<T&, E>::Forward_Error(Self&& self) noexcept
+	{
+		return Base::Forward_Error(std::forward<Self>(self).m_base);
+	}
+
+	template<class T, class E>
+	template<typename Result, typename Self>
+	constexpr Result Expected<T&, E>::Pass_Value(Self&& self)
+	{
+		return Result(self.Ref());
+	}
 
 } // namespace O
 
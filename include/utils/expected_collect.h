@@ -0,0 +1,74 @@
+// File: utils/expected_collect.h
+#ifndef UTILS_EXPECTED_COLLECT_H
+#define UTILS_EXPECTED_COLLECT_H
+
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "expected.h"
+#include "bounded_array.h"
+
+namespace O
+{
+	/// Input range whose elements are Expected (of any form)
+	template<class R>
+	concept Expected_Range = std::ranges::input_range<R> && Is_Expected_v<std::remove_cvref_t<std::ranges::range_reference_t<R>>>;
+
+	/// Expected type of the elements of an Expected_Range
+	template<Expected_Range R>
+	using Range_Expected_t = std::remove_cvref_t<std::ranges::range_reference_t<R>>;
+
+	/// Containers Collect() can append to: `emplace_back` (std::vector) or `Emplace_Back` (Bounded_Vector, Small_Vector)
+	template<class C, class V>
+	concept Collect_Container = std::default_initializable<C>
+		&& (requires(C& c, V&& v) { c.emplace_back(std::forward<V>(v)); } || requires(C& c, V&& v) { c.Emplace_Back(std::forward<V>(v)); });
+
+	// internal: element access and container growth shared by Collect() and Collect_All()
+	struct Expected_Collector
+	{
+		template<class R> static constexpr bool MOVES = !std::is_lvalue_reference_v<R> && !std::ranges::view<std::remove_cvref_t<R>>;
+
+		template<class R, class It> static decltype(auto) Element(It& it);
+		template<class R, class Container> static void Reserve(Container& out, R& range);
+		template<class Container, class V> static void Append(Container& out, V&& value);
+	};
+
+	/**
+	 * @brief Turns a range of Expected into one Expected holding all the values, in a single pass.
+	 *
+	 * Stops at the first failed element and returns its error; an empty element gives an empty result.
+	 * Otherwise the values are appended, in order, to a Container built in place inside the returned Expected.
+	 * When the range is sized, a std::vector or Small_Vector Container is reserved once up front.
+	 * A Bounded_Vector Container too small for the values fails as Emplace_Back() does.
+	 *
+	 * Elements are moved out of an rvalue container (`Collect(std::move(results))`) and of views yielding prvalues, copied otherwise.
+	 *
+	 * @tparam Container Destination, `std::vector<T>` by default
+	 */
+	template<class Container, Expected_Range R>
+	requires Collect_Container<Container, typename Range_Expected_t<R>::Value_Type>
+	Expected<Container, typename Range_Expected_t<R>::Error_Type> Collect(R&& range);
+
+	template<Expected_Range R>
+	requires std::is_object_v<typename Range_Expected_t<R>::Value_Type>
+	auto Collect(R&& range);
+
+	/**
+	 * @brief Same single pass as Collect(), but goes on after a failure to report every error of the range.
+	 *
+	 * Errors are appended to the caller's `errors` buffer; those past its capacity are counted but dropped.
+	 * Values are no longer kept once an element has failed. An empty element counts as a failure with no error to store.
+	 *
+	 * @return The Container of values when every element holds one, the number of failed elements otherwise.
+	 */
+	template<class Container, Expected_Range R, std::size_t M, std::size_t Align>
+	requires Collect_Container<Container, typename Range_Expected_t<R>::Value_Type>
+	Expected<Container, std::size_t> Collect_All(R&& range, Bounded_Vector<typename Range_Expected_t<R>::Error_Type, M, Align>& errors);
+}
+
+#include "expected_collect.hpp"
+
+#endif //UTILS_EXPECTED_COLLECT_H
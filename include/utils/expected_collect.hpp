@@ -0,0 +1,115 @@
+#ifndef UTILS_EXPECTED_COLLECT_HPP
+#define UTILS_EXPECTED_COLLECT_HPP
+
+#include "expected_collect.h"
+
+namespace O
+{
+
+	// --- Expected_Collector ---
+	template<class R, class It>
+	decltype(auto) Expected_Collector::Element(It& it)
+	{
+		if constexpr (MOVES<R>)
+			return std::ranges::iter_move(it);
+		else
+			return *it;
+	}
+
+	template<class R, class Container>
+	void Expected_Collector::Reserve(Container& out, R& range)
+	{
+		if constexpr (std::ranges::sized_range<R>)
+		{
+			const std::size_t size = static_cast<std::size_t>(std::ranges::size(range));
+			if constexpr (requires { out.reserve(size); })
+				out.reserve(size);
+			else if constexpr (requires { out.Reserve(size); })
+				out.Reserve(size);
+		}
+	}
+
+	template<class Container, class V>
+	void Expected_Collector::Append(Container& out, V&& value)
+	{
+		if constexpr (requires { out.emplace_back(std::forward<V>(value)); })
+			out.emplace_back(std::forward<V>(value));
+		else
+			out.Emplace_Back(std::forward<V>(value));
+	}
+
+	// --- Collect ---
+	template<class Container, Expected_Range R>
+	requires Collect_Container<Container, typename Range_Expected_t<R>::Value_Type>
+	Expected<Container, typename Range_Expected_t<R>::Error_Type> Collect(R&& range)
+	{
+		using Result = Expected<Container, typename Range_Expected_t<R>::Error_Type>;
+
+		// the container is filled where it is returned, not moved into the result at the end
+		Result result;
+		result.Emplace_Value();
+		Container& out = result.Value();
+		Expected_Collector::Reserve(out, range);
+
+		for (auto it = std::ranges::begin(range); it != std::ranges::end(range); ++it)
+		{
+			auto&& element = Expected_Collector::Element<R>(it);
+			using Element = decltype(element);
+			if (!element.Has_Value())
+			{
+				if (element.Has_Error())
+					result.Emplace_Error(std::forward<Element>(element).Error());
+				else
+					result = Result();
+				return result;
+			}
+			Expected_Collector::Append(out, std::forward<Element>(element).Value());
+		}
+		return result;
+	}
+
+	template<Expected_Range R>
+	requires std::is_object_v<typename Range_Expected_t<R>::Value_Type>
+	auto Collect(R&& range)
+	{
+		return Collect<std::vector<typename Range_Expected_t<R>::Value_Type>>(std::forward<R>(range));
+	}
+
+	template<class Container, Expected_Range R, std::size_t M, std::size_t Align>
+	requires Collect_Container<Container, typename Range_Expected_t<R>::Value_Type>
+	Expected<Container, std::size_t> Collect_All(R&& range, Bounded_Vector<typename Range_Expected_t<R>::Error_Type, M, Align>& errors)
+	{
+		Expected<Container, std::size_t> result;
+		result.Emplace_Value();
+		Container* out = &result.Value();
+		Expected_Collector::Reserve(*out, range);
+
+		std::size_t failed = 0;
+		for (auto it = std::ranges::begin(range); it != std::ranges::end(range); ++it)
+		{
+			auto&& element = Expected_Collector::Element<R>(it);
+			using Element = decltype(element);
+			if (element.Has_Value())
+			{
+				if (out)
+					Expected_Collector::Append(*out, std::forward<Element>(element).Value());
+				continue;
+			}
+
+			if (failed++ == 0)
+			{
+				// the values collected so far are of no use anymore
+				result.Emplace_Error(std::size_t{ 0 });
+				out = nullptr;
+			}
+			if (element.Has_Error() && !errors.Full())
+				errors.Emplace_Back(std::forward<Element>(element).Error());
+		}
+		if (failed)
+			result.Error() = failed;
+		return result;
+	}
+
+} // namespace O
+
+#endif // UTILS_EXPECTED_COLLECT_HPP
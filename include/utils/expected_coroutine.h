@@ -0,0 +1,173 @@
+// File: utils/expected_coroutine.h
+#ifndef UTILS_EXPECTED_COROUTINE_H
+#define UTILS_EXPECTED_COROUTINE_H
+
+#include <coroutine>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "expected.h"
+#include "exceptions.h"
+
+namespace O
+{
+	/**
+	 * @brief Thread-local free lists recycling the frames of Expected coroutines.
+	 *
+	 * Frames are rounded up to GRANULE bytes. Up to MAX_CACHED freed frames per size are kept for the next call on the same thread,
+	 * so a coroutine called in a loop allocates only once. Frames larger than GRANULE * BUCKETS go straight to the global operator new.
+	 */
+	class Coroutine_Frame_Pool
+	{
+	public:
+		static constexpr std::size_t GRANULE = 64;
+		static constexpr std::size_t BUCKETS = 16;
+		static constexpr std::size_t MAX_CACHED = 8;
+
+		static void* Allocate(std::size_t size);
+		static void Deallocate(void* frame, std::size_t size) noexcept;
+
+		/// Number of frames currently cached by the calling thread
+		static std::size_t Cached_Frames() noexcept;
+
+	private:
+		struct Node { Node* next; };
+		struct Bucket { Node* head = nullptr; std::size_t count = 0; };
+		struct Cache
+		{
+			Bucket buckets[BUCKETS];
+			~Cache();
+		};
+
+		static Cache& Local() noexcept;
+		static constexpr std::size_t Bucket_Index(std::size_t size) noexcept { return (size - 1) / GRANULE; }
+	};
+
+
+	/**
+	 * @brief Promise part shared by every Expected coroutine.
+	 *
+	 * The coroutine runs eagerly to completion inside the call: it never suspends except on a failed `co_await`,
+	 * which writes the error to the result and destroys the frame.
+	 * The member names are the ones required by the coroutine machinery.
+	 */
+	template<class T, class E>
+	class Expected_Promise_Base
+	{
+	public:
+		/**
+		 * @brief What get_return_object() hands to the caller, converted to the returned Expected.
+		 *
+		 * Compilers differ on when that conversion happens. When it happens once the body has run (GCC, MSVC), the body wrote the result here
+		 * and it is moved out. When it happens before (eager conversion), the caller's Expected registers itself and the body writes to it directly.
+		 */
+		class Return_Object
+		{
+		public:
+			explicit Return_Object(Expected_Promise_Base& promise) noexcept;
+			Return_Object(const Return_Object&) = delete;
+			Return_Object& operator=(const Return_Object&) = delete;
+			~Return_Object();
+
+			operator Expected<T, E>();
+
+		private:
+			friend class Expected_Promise_Base;
+
+			Expected<T, E> m_result;
+			Expected_Promise_Base* m_promise; // reset by whichever of the two ends first
+		};
+
+		Expected_Promise_Base() noexcept = default;
+		Expected_Promise_Base(const Expected_Promise_Base&) = delete;
+		Expected_Promise_Base& operator=(const Expected_Promise_Base&) = delete;
+		~Expected_Promise_Base();
+
+		Return_Object get_return_object() noexcept;
+		std::suspend_never initial_suspend() const noexcept { return {}; }
+		std::suspend_never final_suspend() const noexcept { return {}; }
+		void unhandled_exception() const;
+
+		/// `co_await` on any Expected: resumes with its value, or stops the coroutine with its error
+		template<typename Awaited>
+		requires Is_Expected_v<std::remove_cvref_t<Awaited>>
+		auto await_transform(Awaited&& awaited) noexcept;
+
+		static void* operator new(std::size_t size) { return Coroutine_Frame_Pool::Allocate(size); }
+		static void operator delete(void* frame, std::size_t size) noexcept { Coroutine_Frame_Pool::Deallocate(frame, size); }
+
+	protected:
+		Expected<T, E>* m_result = nullptr;
+		Return_Object* m_return_object = nullptr;
+
+	private:
+		template<typename Awaited>
+		class Awaiter
+		{
+		public:
+			Awaiter(Awaited&& awaited, Expected<T, E>* result) noexcept : m_awaited(std::forward<Awaited>(awaited)), m_result(result) {}
+
+			bool await_ready() const noexcept { return m_awaited.Has_Value(); }
+			void await_suspend(std::coroutine_handle<> coroutine);
+			decltype(auto) await_resume(); ///< the value, moved out of an rvalue operand
+
+		private:
+			Awaited&& m_awaited;
+			Expected<T, E>* m_result;
+		};
+
+		// hands the forwarded value of an Expected through Invoke_Value, nothing for Expected<void, E>
+		struct Pass_Through
+		{
+			void operator()() const noexcept {}
+			template<typename V> V&& operator()(V&& value) const noexcept { return std::forward<V>(value); }
+		};
+	};
+
+
+	/**
+	 * @brief Promise of a coroutine returning `Expected<T, E>`.
+	 *        `co_return value;` stores a value, `co_return expected;` stores a whole Expected (an error for instance).
+	 */
+	template<class T, class E>
+	class Expected_Promise : public Expected_Promise_Base<T, E>
+	{
+	public:
+		template<typename U>
+		requires std::constructible_from<T, U&&>
+		void return_value(U&& value);
+
+		void return_value(Expected<T, E>&& result);
+	};
+
+	/// Promise of a coroutine returning `Expected<void, E>`: errors are reported with `co_await`, reaching the end is a success.
+	template<class E>
+	class Expected_Promise<void, E> : public Expected_Promise_Base<void, E>
+	{
+	public:
+		void return_void() noexcept;
+	};
+
+	/// Promise of a coroutine returning `Expected<T&, E>`
+	template<class T, class E>
+	class Expected_Promise<T&, E> : public Expected_Promise_Base<T&, E>
+	{
+	public:
+		void return_value(T& ref) noexcept;
+		void return_value(Expected<T&, E>&& result);
+	};
+}
+
+
+/// Makes any function returning O::Expected usable as a coroutine
+template<class T, class E, class... Args>
+struct std::coroutine_traits<O::Expected<T, E>, Args...>
+{
+	using promise_type = O::Expected_Promise<T, E>;
+};
+
+#include "expected_coroutine.hpp"
+
+#endif //UTILS_EXPECTED_COROUTINE_H
@@ -0,0 +1,182 @@
+#ifndef UTILS_EXPECTED_COROUTINE_HPP
+#define UTILS_EXPECTED_COROUTINE_HPP
+
+#include "expected_coroutine.h"
+
+namespace O
+{
+
+	// --- Coroutine_Frame_Pool ---
+	inline void* Coroutine_Frame_Pool::Allocate(std::size_t size)
+	{
+		const std::size_t index = Bucket_Index(size);
+		if (index >= BUCKETS)
+			return ::operator new(size);
+
+		Bucket& bucket = Local().buckets[index];
+		if (Node* node = bucket.head)
+		{
+			bucket.head = node->next;
+			--bucket.count;
+			return node;
+		}
+		return ::operator new((index + 1) * GRANULE);
+	}
+
+	inline void Coroutine_Frame_Pool::Deallocate(void* frame, std::size_t size) noexcept
+	{
+		const std::size_t index = Bucket_Index(size);
+		if (index >= BUCKETS)
+			return ::operator delete(frame, size);
+
+		Bucket& bucket = Local().buckets[index];
+		if (bucket.count == MAX_CACHED)
+			return ::operator delete(frame, (index + 1) * GRANULE);
+		bucket.head = ::new (frame) Node{ bucket.head };
+		++bucket.count;
+	}
+
+	inline std::size_t Coroutine_Frame_Pool::Cached_Frames() noexcept
+	{
+		std::size_t count = 0;
+		for (const Bucket& bucket : Local().buckets)
+			count += bucket.count;
+		return count;
+	}
+
+	inline Coroutine_Frame_Pool::Cache::~Cache()
+	{
+		for (std::size_t index = 0; index < BUCKETS; ++index)
+			while (Node* node = buckets[index].head)
+			{
+				buckets[index].head = node->next;
+				::operator delete(node, (index + 1) * GRANULE);
+			}
+	}
+
+	inline Coroutine_Frame_Pool::Cache& Coroutine_Frame_Pool::Local() noexcept
+	{
+		thread_local Cache cache;
+		return cache;
+	}
+
+	// --- Expected_Promise_Base::Return_Object ---
+	template<class T, class E>
+	Expected_Promise_Base<T, E>::Return_Object::Return_Object(Expected_Promise_Base& promise) noexcept : m_result(), m_promise(&promise)
+	{
+		promise.m_result = &m_result;
+		promise.m_return_object = this;
+	}
+
+	template<class T, class E>
+	Expected_Promise_Base<T, E>::Return_Object::~Return_Object()
+	{
+		// an exception left the body: the return object goes first
+		if (m_promise)
+			m_promise->m_return_object = nullptr;
+	}
+
+	template<class T, class E>
+	Expected_Promise_Base<T, E>::Return_Object::operator Expected<T, E>()
+	{
+		if (!m_promise)
+			return std::move(m_result);
+
+		// eager conversion, the body has not run yet: the prvalue below is the caller's Expected
+		Expected_Promise_Base* promise = m_promise;
+		promise->m_return_object = nullptr;
+		return Expected<T, E>(Coroutine_Link_Tag_t{}, promise->m_result);
+	}
+
+	// --- Expected_Promise_Base ---
+	template<class T, class E>
+	Expected_Promise_Base<T, E>::~Expected_Promise_Base()
+	{
+		if (m_return_object)
+			m_return_object->m_promise = nullptr;
+	}
+
+	template<class T, class E>
+	typename Expected_Promise_Base<T, E>::Return_Object Expected_Promise_Base<T, E>::get_return_object() noexcept
+	{
+		return Return_Object(*this);
+	}
+
+	template<class T, class E>
+	void Expected_Promise_Base<T, E>::unhandled_exception() const
+	{
+#if O_UTILS_HAS_EXCEPTIONS
+		throw;
+#else
+		Terminate_On_Error("exception escaped an Expected coroutine");
+#endif
+	}
+
+	template<class T, class E>
+	template<typename Awaited>
+	requires Is_Expected_v<std::remove_cvref_t<Awaited>>
+	auto Expected_Promise_Base<T, E>::await_transform(Awaited&& awaited) noexcept
+	{
+		return Awaiter<Awaited>(std::forward<Awaited>(awaited), m_result);
+	}
+
+	template<class T, class E>
+	template<typename Awaited>
+	void Expected_Promise_Base<T, E>::Awaiter<Awaited>::await_suspend(std::coroutine_handle<> coroutine)
+	{
+		using X = std::remove_cvref_t<Awaited>;
+		// an empty awaited Expected leaves the result empty
+		if (m_awaited.Has_Error())
+			m_result->Emplace_Error(X::Forward_Error(std::forward<Awaited>(m_awaited)));
+		coroutine.destroy();
+	}
+
+	template<class T, class E>
+	template<typename Awaited>
+	decltype(auto) Expected_Promise_Base<T, E>::Awaiter<Awaited>::await_resume()
+	{
+		using X = std::remove_cvref_t<Awaited>;
+		using Forwarded = decltype(X::Invoke_Value(std::forward<Awaited>(m_awaited), Pass_Through{}));
+		// an awaited temporary dies with the co_await full expression: its value is moved out, only lvalue operands are referred to
+		if constexpr (std::is_rvalue_reference_v<Forwarded>)
+			return std::remove_cvref_t<Forwarded>(X::Invoke_Value(std::forward<Awaited>(m_awaited), Pass_Through{}));
+		else
+			return X::Invoke_Value(std::forward<Awaited>(m_awaited), Pass_Through{});
+	}
+
+	// --- Expected_Promise ---
+	template<class T, class E>
+	template<typename U>
+	requires std::constructible_from<T, U&&>
+	void Expected_Promise<T, E>::return_value(U&& value)
+	{
+		this->m_result->Emplace_Value(std::forward<U>(value));
+	}
+
+	template<class T, class E>
+	void Expected_Promise<T, E>::return_value(Expected<T, E>&& result)
+	{
+		*this->m_result = std::move(result);
+	}
+
+	template<class E>
+	void Expected_Promise<void, E>::return_void() noexcept
+	{
+		this->m_result->Emplace_Value();
+	}
+
+	template<class T, class E>
+	void Expected_Promise<T&, E>::return_value(T& ref) noexcept
+	{
+		this->m_result->Emplace_Value(ref);
+	}
+
+	template<class T, class E>
+	void Expected_Promise<T&, E>::return_value(Expected<T&, E>&& result)
+	{
+		*this->m_result = std::move(result);
+	}
+
+} // namespace O
+
+#endif // UTILS_EXPECTED_COROUTINE_HPP
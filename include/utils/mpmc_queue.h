@@ -0,0 +1,85 @@
+// File: utils/mpmc_queue.h
+#ifndef UTILS_MPMC_QUEUE_H
+#define UTILS_MPMC_QUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#include "bounded_array.h"
+#include "expected.h"
+#include "queue_common.h"
+
+namespace O
+{
+	/**
+	 * @brief A bounded multi-producer / multi-consumer queue (Dmitry Vyukov's algorithm).
+	 *        Every slot carries a sequence number telling whether it is ready to be written or read for the current lap,
+	 *        so producers and consumers only contend on their own position counter with a single CAS.
+	 *        Slots are allocated inline with the queue: nothing is allocated after construction.
+	 *        Full/empty conditions are returned as `O::Expected` errors, nothing is thrown.
+	 *
+	 * @tparam T Type of transferred elements.
+	 * @tparam N Number of slots, must be a power of two greater than 1.
+	 */
+	template<typename T, std::size_t N>
+	requires (N > 1) && ((N & (N - 1)) == 0)
+	class Mpmc_Queue
+	{
+		// a claimed slot must always be handed on: elements are built before their slot is claimed, then moved in or out of it
+		static_assert(std::is_nothrow_move_constructible_v<T>, "Mpmc_Queue needs a noexcept move constructor");
+
+	private:
+		static constexpr std::size_t MASK = N - 1;
+
+		struct Cell
+		{
+			std::atomic<std::size_t> sequence; ///< pos when writable, pos + 1 when readable
+			Bounded_Storage<T, 1> storage;     ///< Uninitialized element slot
+		};
+
+		alignas(CACHE_LINE_SIZE) std::array<Cell, N> m_buffer;          ///< Element slots
+		alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_enqueue_pos; ///< Next position claimed by producers
+		alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_dequeue_pos; ///< Next position claimed by consumers
+
+		/** @name Internal helpers
+		 *  @{ */
+		static T* Ptr_At(Cell& cell) noexcept;
+		Cell* Claim_Enqueue(std::size_t& pos) noexcept;
+		Cell* Claim_Dequeue(std::size_t& pos) noexcept;
+		/** @} */
+
+	public:
+		/** @name Construction / destruction
+		 *  @brief The queue is neither copyable nor movable. The destructor destroys the elements left inside.
+		 *  @{ */
+		Mpmc_Queue() noexcept;
+		~Mpmc_Queue() noexcept;
+		Mpmc_Queue(const Mpmc_Queue&) = delete;
+		Mpmc_Queue& operator=(const Mpmc_Queue&) = delete;
+		/** @} */
+
+		/** @name Producers / consumers
+		 *  @brief Safe to call from any number of threads.
+		 *  @{ */
+		template<class... Args>
+		Expected<void, Queue_Error> Try_Emplace(Args&&... args);
+		Expected<void, Queue_Error> Try_Push(const T& v);
+		Expected<void, Queue_Error> Try_Push(T&& v);
+		Expected<T, Queue_Error> Try_Pop();
+		/** @} */
+
+		/** @name State
+		 *  @brief Size() is exact only when no other thread is using the queue.
+		 *  @{ */
+		constexpr std::size_t Capacity() const noexcept;
+		std::size_t Size() const noexcept;
+		bool Empty() const noexcept;
+		/** @} */
+	};
+}
+
+#include "mpmc_queue.hpp"
+
+#endif //UTILS_MPMC_QUEUE_H
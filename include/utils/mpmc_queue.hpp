@@ -0,0 +1,148 @@
+#ifndef UTILS_MPMC_QUEUE_HPP
+#define UTILS_MPMC_QUEUE_HPP
+
+#include "mpmc_queue.h"
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+
+// helper implementations
+template<typename T, std::size_t N>
+requires (N > 1) && ((N & (N - 1)) == 0)
+T* O::Mpmc_Queue<T, N>::Ptr_At(Cell& cell) noexcept
+{
+	return cell.storage.elements;
+}
+
+template<typename T, std::size_t N>
+requires (N > 1) && ((N & (N - 1)) == 0)
+typename O::Mpmc_Queue<T, N>::Cell* O::Mpmc_Queue<T, N>::Claim_Enqueue(std::size_t& pos) noexcept
+{
+	pos = m_enqueue_pos.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		Cell& cell = m_buffer[pos & MASK];
+		const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+		const std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+		if (diff == 0)
+		{
+			if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				return &cell;
+		}
+		else if (diff < 0)
+			return nullptr; // slot still holds the previous lap: full
+		else
+			pos = m_enqueue_pos.load(std::memory_order_relaxed);
+	}
+}
+
+template<typename T, std::size_t N>
+requires (N > 1) && ((N & (N - 1)) == 0)
+typename O::Mpmc_Queue<T, N>::Cell* O::Mpmc_Queue<T, N>::Claim_Dequeue(std::size_t& pos) noexcept
+{
+	pos = m_dequeue_pos.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		Cell& cell = m_buffer[pos & MASK];
+		const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+		const std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+		if (diff == 0)
+		{
+			if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				return &cell;
+		}
+		else if (diff < 0)
+			return nullptr; // slot not written yet: empty
+		else
+			pos = m_dequeue_pos.load(std::memory_order_relaxed);
+	}
+}
+
+// construction / destruction
+template<typename T, std::size_t N>
+requires (N > 1) && ((N & (N - 1)) == 0)
+O::Mpmc_Queue<T, N>::Mpmc_Queue() noexcept :
+	m_enqueue_pos(0),
+	m_dequeue_pos(0)
+{
+	for (std::size_t i = 0; i < N; ++i)
+		m_buffer[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template<typename T, std::size_t N>
+requires (N > 1) && ((N & (N - 1)) == 0)
+O::Mpmc_Queue<T, N>::~Mpmc_Queue() noexcept
+{
+	const std::size_t end = m_enqueue_pos.load(std::memory_order_relaxed);
+	for (std::size_t pos = m_dequeue_pos.load(std::memory_order_relaxed); pos != end; ++pos)
+		std::destroy_at(Ptr_At(m_buffer[pos & MASK]));
+}
+
+// producers / consumers
+template<typename T, std::size_t N>
+requires (N > 1) && ((N & (N - 1)) == 0)
+template<class... Args>
+O::Expected<void, O::Queue_Error> O::Mpmc_Queue<T, N>::Try_Emplace(Args&&... args)
+{
+	// a constructor throwing after the claim would leave a slot that never becomes readable: build the element first
+	if constexpr (!std::is_nothrow_constructible_v<T, Args&&...>)
+	{
+		T value(std::forward<Args>(args)...);
+		return Try_Emplace(std::move(value));
+	}
+	else
+	{
+		std::size_t pos;
+		Cell* cell = Claim_Enqueue(pos);
+		if (!cell)
+			return Expected<void, Queue_Error>::Make_Error(Queue_Error::QUEUE_FULL);
+		std::construct_at(Ptr_At(*cell), std::forward<Args>(args)...);
+		cell->sequence.store(pos + 1, std::memory_order_release);
+		return Expected<void, Queue_Error>::Make_Value();
+	}
+}
+
+template<typename T, std::size_t N>
+requires (N > 1) && ((N & (N - 1)) == 0)
+O::Expected<void, O::Queue_Error> O::Mpmc_Queue<T, N>::Try_Push(const T& v) { return Try_Emplace(v); }
+
+template<typename T, std::size_t N>
+requires (N > 1) && ((N & (N - 1)) == 0)
+O::Expected<void, O::Queue_Error> O::Mpmc_Queue<T, N>::Try_Push(T&& v) { return Try_Emplace(std::move(v)); }
+
+template<typename T, std::size_t N>
+requires (N > 1) && ((N & (N - 1)) == 0)
+O::Expected<T, O::Queue_Error> O::Mpmc_Queue<T, N>::Try_Pop()
+{
+	std::size_t pos;
+	Cell* cell = Claim_Dequeue(pos);
+	if (!cell)
+		return Expected<T, Queue_Error>::Make_Error(Queue_Error::QUEUE_EMPTY);
+	T* slot = Ptr_At(*cell);
+	auto out = Expected<T, Queue_Error>::Make_Value(std::move(*slot));
+	std::destroy_at(slot);
+	// hand the slot to the producers of the next lap
+	cell->sequence.store(pos + N, std::memory_order_release);
+	return out;
+}
+
+// state
+template<typename T, std::size_t N>
+requires (N > 1) && ((N & (N - 1)) == 0)
+constexpr std::size_t O::Mpmc_Queue<T, N>::Capacity() const noexcept { return N; }
+
+template<typename T, std::size_t N>
+requires (N > 1) && ((N & (N - 1)) == 0)
+std::size_t O::Mpmc_Queue<T, N>::Size() const noexcept
+{
+	const std::size_t dequeue = m_dequeue_pos.load(std::memory_order_acquire);
+	const std::size_t enqueue = m_enqueue_pos.load(std::memory_order_acquire);
+	return enqueue > dequeue ? enqueue - dequeue : 0;
+}
+
+template<typename T, std::size_t N>
+requires (N > 1) && ((N & (N - 1)) == 0)
+bool O::Mpmc_Queue<T, N>::Empty() const noexcept { return Size() == 0; }
+
+#endif // UTILS_MPMC_QUEUE_HPP
@@ -0,0 +1,97 @@
+// File: utils/niche.h
+#ifndef UTILS_NICHE_H
+#define UTILS_NICHE_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace O
+{
+	/**
+	 * @brief Customization point describing a "niche" of T: bit patterns a valid T never holds.
+	 *        Layout-sensitive wrappers (`O::Expected`) use it to store their discriminant inside T instead of next to it.
+	 *
+	 * The niche is a `Tag` (unsigned integer) read at byte offset `TAG_OFFSET` of T's object representation.
+	 * A valid T never has `FIRST_SPARE_TAG` or `SECOND_SPARE_TAG` there.
+	 * While one of them is written, the other bytes of T are free and may hold another object.
+	 *
+	 * A specialization provides:
+	 *  - `static constexpr bool ENABLED = true;`
+	 *  - `using Tag = <unsigned integer type>;`
+	 *  - `static constexpr std::size_t TAG_OFFSET;`
+	 *  - `static constexpr Tag FIRST_SPARE_TAG, SECOND_SPARE_TAG;`
+	 *
+	 * Only declare patterns that no valid T can hold, whatever its origin (arithmetic, bit_cast, binary input):
+	 * floating-point types have none, every bit pattern of a double is a double.
+	 *
+	 * Built-in specialization:
+	 *  - object pointers to types aligned on 2 bytes or more: odd values of the low-order byte.
+	 *
+	 * Example, an enum whose high-order byte is never used:
+	 * @code
+	 * enum class Geo_Status : std::uint32_t { OK, NO_MATCH, AMBIGUOUS };
+	 * template<> struct O::Niche_Traits<Geo_Status>
+	 * {
+	 *     static constexpr bool ENABLED = true;
+	 *     using Tag = std::uint8_t;
+	 *     static constexpr std::size_t TAG_OFFSET = std::endian::native == std::endian::little ? 3 : 0;
+	 *     static constexpr Tag FIRST_SPARE_TAG = 0xFE;
+	 *     static constexpr Tag SECOND_SPARE_TAG = 0xFF;
+	 * };
+	 * @endcode
+	 *
+	 * @tparam T Described type, must be trivially copyable.
+	 */
+	template<typename T>
+	struct Niche_Traits
+	{
+		static constexpr bool ENABLED = false;
+	};
+
+
+	template<typename U>
+	requires (alignof(U) >= 2)
+	struct Niche_Traits<U*>
+	{
+		static constexpr bool ENABLED = true;
+		using Tag = std::uint8_t;
+		static constexpr std::size_t TAG_OFFSET = std::endian::native == std::endian::little ? 0 : sizeof(U*) - 1;
+		static constexpr Tag FIRST_SPARE_TAG = 0x01;
+		static constexpr Tag SECOND_SPARE_TAG = 0x03;
+	};
+
+
+
+	/// Returned by Niche_Other_Offset() when the other object does not fit next to the tag.
+	inline constexpr std::size_t NICHE_NO_FIT = std::numeric_limits<std::size_t>::max();
+
+
+	/**
+	 * @brief Byte offset at which an Other object can live inside a Carrier whose niche tag is set.
+	 * @return the first suitably aligned offset not overlapping the tag, or NICHE_NO_FIT.
+	 */
+	template<typename Carrier, typename Other>
+	constexpr std::size_t Niche_Other_Offset() noexcept
+	{
+		using Traits = Niche_Traits<Carrier>;
+		constexpr std::size_t tag_begin = Traits::TAG_OFFSET;
+		constexpr std::size_t tag_end = tag_begin + sizeof(typename Traits::Tag);
+		if (sizeof(Other) <= tag_begin)
+			return 0;
+		const std::size_t offset = (tag_end + alignof(Other) - 1) / alignof(Other) * alignof(Other);
+		return offset + sizeof(Other) <= sizeof(Carrier) ? offset : NICHE_NO_FIT;
+	}
+
+
+	/**
+	 * @brief Carrier has a niche and an Other object fits in the bytes around its tag.
+	 */
+	template<typename Carrier, typename Other>
+	concept Niche_Fits = Niche_Traits<Carrier>::ENABLED
+		&& (alignof(Other) <= alignof(Carrier))
+		&& (Niche_Other_Offset<Carrier, Other>() != NICHE_NO_FIT);
+}
+
+#endif // UTILS_NICHE_H
@@ -0,0 +1,27 @@
+// File: utils/queue_common.h
+#ifndef UTILS_QUEUE_COMMON_H
+#define UTILS_QUEUE_COMMON_H
+
+#include <cstddef>
+
+namespace O
+{
+	/**
+	 * @brief Size assumed for a cache line when laying out concurrently written fields.
+	 *        Fields written by different threads are aligned on it to avoid false sharing.
+	 */
+	inline constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+
+	/**
+	 * @brief Error values returned (never thrown) by the bounded concurrent queues.
+	 */
+	enum class Queue_Error
+	{
+		NO_ERROR = 0,
+		QUEUE_FULL,
+		QUEUE_EMPTY
+	};
+}
+
+#endif //UTILS_QUEUE_COMMON_H
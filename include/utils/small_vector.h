@@ -0,0 +1,112 @@
+// File: utils/small_vector.h
+#ifndef UTILS_SMALL_VECTOR_H
+#define UTILS_SMALL_VECTOR_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "bounded_array.h"
+
+namespace O
+{
+	/**
+	 * @brief A vector-like container that keeps up to N elements inline and spills to the heap past that.
+	 *        The inline buffer is the same aligned storage as `Bounded_Vector`. Once more than N elements are needed,
+	 *        the content is relocated into a heap block that grows geometrically (x2), like `std::vector`.
+	 *        Small sizes therefore never allocate while large ones never fail.
+	 *        Growing gives the strong guarantee of `std::vector`: elements are moved only when T's move cannot throw,
+	 *        copied otherwise, and a failed growth leaves the container as it was.
+	 *        Out-of-range `At()` and `Pop_Back()` on an empty container throw the same `Bounded_Vector_Exception` values.
+	 *
+	 * @tparam T Type of stored elements.
+	 * @tparam N Number of elements stored inline before the first allocation.
+	 */
+	template<typename T, std::size_t N>
+	class Small_Vector
+	{
+		static_assert(N > 0, "Small_Vector needs at least one inline slot");
+
+	private:
+		// storage: the uninitialized slots of Bounded_Vector, for up to N objects of T
+		Bounded_Storage<T, N> m_buffer;     ///< Inline buffer used while Size() <= N
+		T* m_data;                          ///< Points to m_buffer or to the heap block
+		std::size_t m_size = 0;             ///< Number of live elements
+		std::size_t m_capacity = N;         ///< Number of slots available behind m_data
+
+		/** @name Internal helpers
+		 *  @{ */
+		T* Inline_Data() noexcept;
+		const T* Inline_Data() const noexcept;
+		void Reallocate(std::size_t new_capacity);
+		template<class... Args>
+		void Grow_And_Emplace_Back(Args&&... args);
+		void Release_Heap() noexcept;
+		void Steal(Small_Vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+		static void Relocate(T* from, std::size_t count, T* to) noexcept(std::is_nothrow_move_constructible_v<T>);
+		/** @} */
+
+	public:
+		/** @name Construction / assignment
+		 *  @brief Copies allocate only when the source does not fit inline.
+		 *         Moves steal the heap block when there is one, otherwise move elements one by one; the moved-from container is left empty.
+		 *  @{ */
+		Small_Vector() noexcept;
+		~Small_Vector() noexcept;
+		Small_Vector(const Small_Vector& other);
+		Small_Vector(Small_Vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+		Small_Vector& operator=(const Small_Vector& other);
+		Small_Vector& operator=(Small_Vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+		template<typename... Args>
+		requires (sizeof...(Args) > 0) && (std::constructible_from<T, Args> && ...)
+		explicit Small_Vector(Args&&... args);
+		/** @} */
+
+		/** @name Capacity / state
+		 *  @{ */
+		static constexpr std::size_t Inline_Capacity() noexcept;
+		std::size_t Capacity() const noexcept;
+		std::size_t Size() const noexcept;
+		bool Empty() const noexcept;
+		bool Is_Inline() const noexcept;
+		void Reserve(std::size_t capacity);
+		/** @} */
+
+		/** @name Element access
+		 *  @{ */
+		T& operator[](std::size_t i) noexcept;
+		const T& operator[](std::size_t i) const noexcept;
+		T& At(std::size_t i);
+		const T& At(std::size_t i) const;
+		T* Data() noexcept;
+		const T* Data() const noexcept;
+		/** @} */
+
+		/** @name Modifiers
+		 *  @{ */
+		template<class... Args>
+		void Emplace_Back(Args&&... args);
+		void Push_Back(const T& v);
+		void Push_Back(T&& v);
+		void Pop_Back();
+		void Clear() noexcept;
+		/** @} */
+
+		/** @name Iterators
+		 *  @brief Pointer-style contiguous iterators compatible with standard algorithms.
+		 *  @{ */
+		T* begin() noexcept;
+		T* end() noexcept;
+		const T* begin() const noexcept;
+		const T* end() const noexcept;
+		const T* cbegin() const noexcept;
+		const T* cend() const noexcept;
+		/** @} */
+	};
+}
+
+#include "small_vector.hpp"
+
+#endif //UTILS_SMALL_VECTOR_H
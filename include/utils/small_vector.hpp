@@ -0,0 +1,308 @@
+#ifndef UTILS_SMALL_VECTOR_HPP
+#define UTILS_SMALL_VECTOR_HPP
+
+#include "small_vector.h"
+#include <cstring>
+#include <memory>
+#include <utility>
+
+
+// helper implementations
+template<typename T, std::size_t N>
+T* O::Small_Vector<T, N>::Inline_Data() noexcept
+{
+	return m_buffer.elements;
+}
+
+template<typename T, std::size_t N>
+const T* O::Small_Vector<T, N>::Inline_Data() const noexcept
+{
+	return m_buffer.elements;
+}
+
+template<typename T, std::size_t N>
+void O::Small_Vector<T, N>::Relocate(T* from, std::size_t count, T* to) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+	if constexpr (std::is_trivially_copyable_v<T>)
+	{
+		if (count > 0)
+			std::memcpy(static_cast<void*>(to), static_cast<const void*>(from), count * sizeof(T));
+	}
+	else
+	{
+		// as std::move_if_noexcept: a copy that throws leaves the sources intact; the built prefix of `to` is destroyed
+		if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+			std::uninitialized_move(from, from + count, to);
+		else
+			std::uninitialized_copy(from, from + count, to);
+		std::destroy(from, from + count);
+	}
+}
+
+template<typename T, std::size_t N>
+void O::Small_Vector<T, N>::Release_Heap() noexcept
+{
+	if (m_data != Inline_Data())
+		std::allocator<T>{}.deallocate(m_data, m_capacity);
+	m_data = Inline_Data();
+	m_capacity = N;
+}
+
+template<typename T, std::size_t N>
+void O::Small_Vector<T, N>::Reallocate(std::size_t new_capacity)
+{
+	T* block = std::allocator<T>{}.allocate(new_capacity);
+	O_TRY
+	{
+		Relocate(m_data, m_size, block);
+	}
+	O_CATCH_ALL
+	{
+		// the elements are still in place: only the new block goes
+		std::allocator<T>{}.deallocate(block, new_capacity);
+		O_RETHROW;
+	}
+	Release_Heap();
+	m_data = block;
+	m_capacity = new_capacity;
+}
+
+template<typename T, std::size_t N>
+template<class... Args>
+void O::Small_Vector<T, N>::Grow_And_Emplace_Back(Args&&... args)
+{
+	// the new element is built first so that args may still refer to an element of this container
+	const std::size_t new_capacity = m_capacity * 2;
+	T* block = std::allocator<T>{}.allocate(new_capacity);
+	O_TRY
+	{
+		::new (static_cast<void*>(block + m_size)) T(std::forward<Args>(args)...);
+	}
+	O_CATCH_ALL
+	{
+		std::allocator<T>{}.deallocate(block, new_capacity);
+		O_RETHROW;
+	}
+	O_TRY
+	{
+		Relocate(m_data, m_size, block);
+	}
+	O_CATCH_ALL
+	{
+		std::destroy_at(block + m_size);
+		std::allocator<T>{}.deallocate(block, new_capacity);
+		O_RETHROW;
+	}
+	Release_Heap();
+	m_data = block;
+	m_capacity = new_capacity;
+	++m_size;
+}
+
+template<typename T, std::size_t N>
+void O::Small_Vector<T, N>::Steal(Small_Vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+	if (other.m_data != other.Inline_Data())
+	{
+		m_data = other.m_data;
+		m_capacity = other.m_capacity;
+		other.m_data = other.Inline_Data();
+		other.m_capacity = N;
+	}
+	else
+		Relocate(other.m_data, other.m_size, m_data);
+	m_size = other.m_size;
+	other.m_size = 0;
+}
+
+// construction / destruction
+template<typename T, std::size_t N>
+O::Small_Vector<T, N>::Small_Vector() noexcept :
+	m_data(Inline_Data())
+{
+
+}
+
+template<typename T, std::size_t N>
+O::Small_Vector<T, N>::~Small_Vector() noexcept
+{
+	Clear();
+	Release_Heap();
+}
+
+// copy ctor
+template<typename T, std::size_t N>
+O::Small_Vector<T, N>::Small_Vector(const Small_Vector& other) :
+	m_data(Inline_Data())
+{
+	Reserve(other.m_size);
+	O_TRY
+	{
+		std::uninitialized_copy(other.begin(), other.end(), m_data);
+	}
+	O_CATCH_ALL
+	{
+		// no destructor runs for a throwing constructor: give the block back here
+		Release_Heap();
+		O_RETHROW;
+	}
+	m_size = other.m_size;
+}
+
+// move ctor
+template<typename T, std::size_t N>
+O::Small_Vector<T, N>::Small_Vector(Small_Vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) :
+	m_data(Inline_Data())
+{
+	Steal(std::move(other));
+}
+
+// copy assign
+template<typename T, std::size_t N>
+O::Small_Vector<T, N>& O::Small_Vector<T, N>::operator=(const Small_Vector& other)
+{
+	if (this == &other) return *this;
+	Clear();
+	Reserve(other.m_size);
+	std::uninitialized_copy(other.begin(), other.end(), m_data);
+	m_size = other.m_size;
+	return *this;
+}
+
+// move assign
+template<typename T, std::size_t N>
+O::Small_Vector<T, N>& O::Small_Vector<T, N>::operator=(Small_Vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+	if (this == &other) return *this;
+	Clear();
+	Release_Heap();
+	Steal(std::move(other));
+	return *this;
+}
+
+template<typename T, std::size_t N>
+template<typename... Args>
+requires (sizeof...(Args) > 0) && (std::constructible_from<T, Args> && ...)
+O::Small_Vector<T, N>::Small_Vector(Args&&... args) :
+	m_data(Inline_Data())
+{
+	Reserve(sizeof...(Args));
+	O_TRY
+	{
+		(Emplace_Back(std::forward<Args>(args)), ...);
+	}
+	O_CATCH_ALL
+	{
+		Clear();
+		Release_Heap();
+		O_RETHROW;
+	}
+}
+
+// Capacity / state
+template<typename T, std::size_t N>
+constexpr std::size_t O::Small_Vector<T, N>::Inline_Capacity() noexcept { return N; }
+
+template<typename T, std::size_t N>
+std::size_t O::Small_Vector<T, N>::Capacity() const noexcept { return m_capacity; }
+
+template<typename T, std::size_t N>
+std::size_t O::Small_Vector<T, N>::Size() const noexcept { return m_size; }
+
+template<typename T, std::size_t N>
+bool O::Small_Vector<T, N>::Empty() const noexcept { return m_size == 0; }
+
+template<typename T, std::size_t N>
+bool O::Small_Vector<T, N>::Is_Inline() const noexcept { return m_data == Inline_Data(); }
+
+template<typename T, std::size_t N>
+void O::Small_Vector<T, N>::Reserve(std::size_t capacity)
+{
+	if (capacity > m_capacity)
+		Reallocate(capacity);
+}
+
+// element access
+template<typename T, std::size_t N>
+T& O::Small_Vector<T, N>::operator[](std::size_t i) noexcept { return m_data[i]; }
+
+template<typename T, std::size_t N>
+const T& O::Small_Vector<T, N>::operator[](std::size_t i) const noexcept { return m_data[i]; }
+
+template<typename T, std::size_t N>
+T& O::Small_Vector<T, N>::At(std::size_t i)
+{
+	if (i >= m_size) O_THROW(Bounded_Vector_Exception::OUT_OF_RANGE);
+	return m_data[i];
+}
+
+template<typename T, std::size_t N>
+const T& O::Small_Vector<T, N>::At(std::size_t i) const
+{
+	if (i >= m_size) O_THROW(Bounded_Vector_Exception::OUT_OF_RANGE);
+	return m_data[i];
+}
+
+template<typename T, std::size_t N>
+T* O::Small_Vector<T, N>::Data() noexcept { return m_data; }
+
+template<typename T, std::size_t N>
+const T* O::Small_Vector<T, N>::Data() const noexcept { return m_data; }
+
+// modifiers
+template<typename T, std::size_t N>
+template<class... Args>
+void O::Small_Vector<T, N>::Emplace_Back(Args&&... args)
+{
+	if (m_size == m_capacity) [[unlikely]]
+	{
+		Grow_And_Emplace_Back(std::forward<Args>(args)...);
+		return;
+	}
+	::new (static_cast<void*>(m_data + m_size)) T(std::forward<Args>(args)...);
+	++m_size;
+}
+
+template<typename T, std::size_t N>
+void O::Small_Vector<T, N>::Push_Back(const T& v) { Emplace_Back(v); }
+
+template<typename T, std::size_t N>
+void O::Small_Vector<T, N>::Push_Back(T&& v) { Emplace_Back(std::move(v)); }
+
+template<typename T, std::size_t N>
+void O::Small_Vector<T, N>::Pop_Back()
+{
+	if (Empty()) O_THROW(Bounded_Vector_Exception::NO_MORE_ELEMENT_TO_POP);
+	--m_size;
+	m_data[m_size].~T();
+}
+
+template<typename T, std::size_t N>
+void O::Small_Vector<T, N>::Clear() noexcept
+{
+	while (m_size > 0) {
+		--m_size;
+		m_data[m_size].~T();
+	}
+}
+
+// iterators
+template<typename T, std::size_t N>
+T* O::Small_Vector<T, N>::begin() noexcept { return m_data; }
+
+template<typename T, std::size_t N>
+T* O::Small_Vector<T, N>::end() noexcept { return m_data + m_size; }
+
+template<typename T, std::size_t N>
+const T* O::Small_Vector<T, N>::begin() const noexcept { return m_data; }
+
+template<typename T, std::size_t N>
+const T* O::Small_Vector<T, N>::end() const noexcept { return m_data + m_size; }
+
+template<typename T, std::size_t N>
+const T* O::Small_Vector<T, N>::cbegin() const noexcept { return m_data; }
+
+template<typename T, std::size_t N>
+const T* O::Small_Vector<T, N>::cend() const noexcept { return m_data + m_size; }
+
+#endif // UTILS_SMALL_VECTOR_HPP
@@ -0,0 +1,98 @@
+// File: utils/spsc_queue.h
+#ifndef UTILS_SPSC_QUEUE_H
+#define UTILS_SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+#include "bounded_array.h"
+#include "exceptions.h"
+#include "expected.h"
+#include "queue_common.h"
+
+namespace O
+{
+	/**
+	 * @brief A wait-free bounded single-producer / single-consumer queue.
+	 *        Slots are the same uninitialized aligned storage as `Bounded_Vector`, indexed with a mask (N must be a power of two).
+	 *        The producer and consumer indices live on separate cache lines, and each side keeps a cached copy of the
+	 *        opposite index so it only reads the shared atomic when the queue looks full (producer) or empty (consumer).
+	 *        Full/empty conditions are returned as `O::Expected` errors, nothing is thrown.
+	 *
+	 * @tparam T Type of transferred elements.
+	 * @tparam N Number of slots, must be a power of two.
+	 *
+	 * @note Exactly one thread may call the Try_Push* functions and exactly one thread the Try_Pop* functions.
+	 */
+	template<typename T, std::size_t N>
+	requires (N > 0) && ((N & (N - 1)) == 0)
+	class Spsc_Queue
+	{
+	private:
+		static constexpr std::size_t MASK = N - 1;
+
+		// producer side
+		alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_tail{ 0 }; ///< Next slot to write, published by the producer
+		std::size_t m_cached_head = 0;                                  ///< Producer copy of m_head
+
+		// consumer side
+		alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_head{ 0 }; ///< Next slot to read, published by the consumer
+		std::size_t m_cached_tail = 0;                                  ///< Consumer copy of m_tail
+
+		alignas(CACHE_LINE_SIZE) Bounded_Storage<T, N> m_buffer;     ///< Element slots
+
+		/** @name Internal helpers
+		 *  @{ */
+		T* Ptr_At(std::size_t index) noexcept;
+		std::size_t Free_Slots(std::size_t tail, std::size_t wanted) noexcept;
+		std::size_t Ready_Slots(std::size_t head, std::size_t wanted) noexcept;
+		/** @} */
+
+	public:
+		/** @name Construction / destruction
+		 *  @brief The queue is neither copyable nor movable. The destructor destroys the elements left inside.
+		 *  @{ */
+		Spsc_Queue() noexcept = default;
+		~Spsc_Queue() noexcept;
+		Spsc_Queue(const Spsc_Queue&) = delete;
+		Spsc_Queue& operator=(const Spsc_Queue&) = delete;
+		/** @} */
+
+		/** @name Producer
+		 *  @brief Try_Push_N pushes as many elements of the range as there is room for and returns that count.
+		 *         QUEUE_FULL is returned when nothing could be pushed. When building an element throws, none of the batch is pushed.
+		 *  @{ */
+		template<class... Args>
+		Expected<void, Queue_Error> Try_Emplace(Args&&... args);
+		Expected<void, Queue_Error> Try_Push(const T& v);
+		Expected<void, Queue_Error> Try_Push(T&& v);
+		template<std::ranges::sized_range R>
+		requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+		Expected<std::size_t, Queue_Error> Try_Push_N(R&& range);
+		/** @} */
+
+		/** @name Consumer
+		 *  @brief Try_Pop_N moves up to max_count elements into out and returns that count.
+		 *         QUEUE_EMPTY is returned when nothing could be popped. When writing to out throws, the elements already written are popped.
+		 *  @{ */
+		Expected<T, Queue_Error> Try_Pop();
+		template<std::output_iterator<T&&> Out>
+		Expected<std::size_t, Queue_Error> Try_Pop_N(Out out, std::size_t max_count);
+		/** @} */
+
+		/** @name State
+		 *  @brief Size() is exact only when no other thread is using the queue.
+		 *  @{ */
+		constexpr std::size_t Capacity() const noexcept;
+		std::size_t Size() const noexcept;
+		bool Empty() const noexcept;
+		/** @} */
+	};
+}
+
+#include "spsc_queue.hpp"
+
+#endif //UTILS_SPSC_QUEUE_H
@@ -0,0 +1,174 @@
+#ifndef UTILS_SPSC_QUEUE_HPP
+#define UTILS_SPSC_QUEUE_HPP
+
+#include "spsc_queue.h"
+#include <memory>
+#include <utility>
+
+
+// helper implementations
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+T* O::Spsc_Queue<T, N>::Ptr_At(std::size_t index) noexcept
+{
+	return m_buffer.elements + (index & MASK);
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+std::size_t O::Spsc_Queue<T, N>::Free_Slots(std::size_t tail, std::size_t wanted) noexcept
+{
+	// only touch the consumer cache line when the cached view is not enough
+	std::size_t free = N - (tail - m_cached_head);
+	if (free < wanted)
+	{
+		m_cached_head = m_head.load(std::memory_order_acquire);
+		free = N - (tail - m_cached_head);
+	}
+	return free;
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+std::size_t O::Spsc_Queue<T, N>::Ready_Slots(std::size_t head, std::size_t wanted) noexcept
+{
+	// only touch the producer cache line when the cached view is not enough
+	std::size_t ready = m_cached_tail - head;
+	if (ready < wanted)
+	{
+		m_cached_tail = m_tail.load(std::memory_order_acquire);
+		ready = m_cached_tail - head;
+	}
+	return ready;
+}
+
+// destructor
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+O::Spsc_Queue<T, N>::~Spsc_Queue() noexcept
+{
+	const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+	for (std::size_t head = m_head.load(std::memory_order_relaxed); head != tail; ++head)
+		Ptr_At(head)->~T();
+}
+
+// producer
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+template<class... Args>
+O::Expected<void, O::Queue_Error> O::Spsc_Queue<T, N>::Try_Emplace(Args&&... args)
+{
+	const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+	if (Free_Slots(tail, 1) == 0)
+		return Expected<void, Queue_Error>::Make_Error(Queue_Error::QUEUE_FULL);
+	std::construct_at(Ptr_At(tail), std::forward<Args>(args)...);
+	m_tail.store(tail + 1, std::memory_order_release);
+	return Expected<void, Queue_Error>::Make_Value();
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+O::Expected<void, O::Queue_Error> O::Spsc_Queue<T, N>::Try_Push(const T& v) { return Try_Emplace(v); }
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+O::Expected<void, O::Queue_Error> O::Spsc_Queue<T, N>::Try_Push(T&& v) { return Try_Emplace(std::move(v)); }
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+template<std::ranges::sized_range R>
+requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+O::Expected<std::size_t, O::Queue_Error> O::Spsc_Queue<T, N>::Try_Push_N(R&& range)
+{
+	const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+	const std::size_t wanted = static_cast<std::size_t>(std::ranges::size(range));
+	const std::size_t free = Free_Slots(tail, wanted);
+	const std::size_t count = (wanted < free) ? wanted : free;
+	if (count == 0 && wanted > 0)
+		return Expected<std::size_t, Queue_Error>::Make_Error(Queue_Error::QUEUE_FULL);
+
+	auto it = std::ranges::begin(range);
+	std::size_t built = 0;
+	O_TRY
+	{
+		for (; built < count; ++built, ++it)
+			std::construct_at(Ptr_At(tail + built), *it);
+	}
+	O_CATCH_ALL
+	{
+		// nothing was published: the batch is pushed whole or not at all
+		for (std::size_t i = 0; i < built; ++i)
+			Ptr_At(tail + i)->~T();
+		O_RETHROW;
+	}
+	// a single release store publishes the whole batch
+	m_tail.store(tail + count, std::memory_order_release);
+	return Expected<std::size_t, Queue_Error>::Make_Value(count);
+}
+
+// consumer
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+O::Expected<T, O::Queue_Error> O::Spsc_Queue<T, N>::Try_Pop()
+{
+	const std::size_t head = m_head.load(std::memory_order_relaxed);
+	if (Ready_Slots(head, 1) == 0)
+		return Expected<T, Queue_Error>::Make_Error(Queue_Error::QUEUE_EMPTY);
+	T* slot = Ptr_At(head);
+	auto out = Expected<T, Queue_Error>::Make_Value(std::move(*slot));
+	slot->~T();
+	m_head.store(head + 1, std::memory_order_release);
+	return out;
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+template<std::output_iterator<T&&> Out>
+O::Expected<std::size_t, O::Queue_Error> O::Spsc_Queue<T, N>::Try_Pop_N(Out out, std::size_t max_count)
+{
+	const std::size_t head = m_head.load(std::memory_order_relaxed);
+	const std::size_t ready = Ready_Slots(head, max_count);
+	const std::size_t count = (max_count < ready) ? max_count : ready;
+	if (count == 0 && max_count > 0)
+		return Expected<std::size_t, Queue_Error>::Make_Error(Queue_Error::QUEUE_EMPTY);
+
+	std::size_t done = 0;
+	O_TRY
+	{
+		for (; done < count; ++done, ++out)
+		{
+			T* slot = Ptr_At(head + done);
+			*out = std::move(*slot);
+			slot->~T();
+		}
+	}
+	O_CATCH_ALL
+	{
+		// the elements already handed out are gone: free their slots, the failing one stays in the queue
+		m_head.store(head + done, std::memory_order_release);
+		O_RETHROW;
+	}
+	// a single release store frees the whole batch
+	m_head.store(head + count, std::memory_order_release);
+	return Expected<std::size_t, Queue_Error>::Make_Value(count);
+}
+
+// state
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+constexpr std::size_t O::Spsc_Queue<T, N>::Capacity() const noexcept { return N; }
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+std::size_t O::Spsc_Queue<T, N>::Size() const noexcept
+{
+	// head first: the tail read afterwards can only be ahead of it
+	const std::size_t head = m_head.load(std::memory_order_acquire);
+	return m_tail.load(std::memory_order_acquire) - head;
+}
+
+template<typename T, std::size_t N>
+requires (N > 0) && ((N & (N - 1)) == 0)
+bool O::Spsc_Queue<T, N>::Empty() const noexcept { return Size() == 0; }
+
+#endif // UTILS_SPSC_QUEUE_HPP
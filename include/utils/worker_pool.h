@@ -0,0 +1,86 @@
+// File: utils/worker_pool.h
+#ifndef UTILS_WORKER_POOL_H
+#define UTILS_WORKER_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "exceptions.h"
+
+namespace O
+{
+	/**
+	 * @brief Fixed set of worker threads running fork-join jobs: `Run(count, task)` calls `task(i)` for every i in [0, count)
+	 *        on the workers and on the calling thread, and returns once all of them are done.
+	 *
+	 * Tasks are claimed one by one from a shared counter, in increasing order, so uneven tasks balance themselves.
+	 * When a task throws, the tasks after it that have not started yet are skipped, and the exception of the
+	 * lowest failing task is rethrown by Run(): the same one a serial loop would have thrown.
+	 *
+	 * Jobs run one at a time; Run() called from inside a task (or with no worker) runs the job serially on the calling thread.
+	 */
+	class Worker_Pool
+	{
+	public:
+		/// Starts `workers` threads; the thread calling Run() takes part too
+		explicit Worker_Pool(std::size_t workers);
+		~Worker_Pool();
+
+		Worker_Pool(const Worker_Pool&) = delete;
+		Worker_Pool& operator=(const Worker_Pool&) = delete;
+
+		/// Process-wide pool with one worker per hardware thread but the caller's, started on first use
+		static Worker_Pool& Shared();
+
+		/// Number of threads running a job: the workers and the caller
+		std::size_t Concurrency() const noexcept;
+
+		/**
+		 * @brief Calls `task(i)` for i in [0, count), concurrently, and waits for all of them.
+		 * @throw the exception of the lowest task that threw, if any
+		 */
+		template<typename Task>
+		requires std::invocable<Task&, std::size_t>
+		void Run(std::size_t count, Task&& task);
+
+	private:
+		struct Job
+		{
+			Job(void (*r)(void*, std::size_t), void* t, std::size_t n) noexcept : run(r), task(t), count(n), failed(n) {}
+
+			void (*run)(void* task, std::size_t index);
+			void* task;
+			std::size_t count;
+			std::atomic<std::size_t> next{ 0 };
+			std::atomic<std::size_t> failed;   ///< lowest task that threw, count when none
+			std::exception_ptr error;          ///< exception of `failed`, under m_mutex
+		};
+
+		void Work_Loop();
+		void Execute(Job& job);
+
+		static bool& Inside_Job() noexcept;
+
+		std::vector<std::thread> m_threads;
+
+		std::mutex m_run_mutex;            ///< one job at a time
+		std::mutex m_mutex;                ///< guards the fields below
+		std::condition_variable m_wake;    ///< new job or stop, for the workers
+		std::condition_variable m_idle;    ///< last worker left the job, for the caller
+		Job* m_job = nullptr;
+		std::uint64_t m_generation = 0;    ///< bumped by every job
+		std::size_t m_busy = 0;            ///< workers inside m_job
+		bool m_stop = false;
+	};
+}
+
+#include "worker_pool.hpp"
+
+#endif //UTILS_WORKER_POOL_H
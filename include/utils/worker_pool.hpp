@@ -0,0 +1,141 @@
+#ifndef UTILS_WORKER_POOL_HPP
+#define UTILS_WORKER_POOL_HPP
+
+#include "worker_pool.h"
+
+namespace O
+{
+
+	inline Worker_Pool::Worker_Pool(std::size_t workers)
+	{
+		m_threads.reserve(workers);
+		for (std::size_t i = 0; i < workers; ++i)
+			m_threads.emplace_back([this] { Work_Loop(); });
+	}
+
+	inline Worker_Pool::~Worker_Pool()
+	{
+		{
+			std::lock_guard lock(m_mutex);
+			m_stop = true;
+		}
+		m_wake.notify_all();
+		for (std::thread& thread : m_threads)
+			thread.join();
+	}
+
+	inline Worker_Pool& Worker_Pool::Shared()
+	{
+		static Worker_Pool pool(std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0);
+		return pool;
+	}
+
+	inline std::size_t Worker_Pool::Concurrency() const noexcept
+	{
+		return m_threads.size() + 1;
+	}
+
+	inline bool& Worker_Pool::Inside_Job() noexcept
+	{
+		thread_local bool inside = false;
+		return inside;
+	}
+
+	template<typename Task>
+	requires std::invocable<Task&, std::size_t>
+	void Worker_Pool::Run(std::size_t count, Task&& task)
+	{
+		if (count == 0)
+			return;
+		if (count == 1 || m_threads.empty() || Inside_Job())
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				task(i);
+			return;
+		}
+
+		std::lock_guard run_lock(m_run_mutex);
+		Job job([](void* t, std::size_t i) { (*static_cast<std::remove_reference_t<Task>*>(t))(i); }, std::addressof(task), count);
+		{
+			std::lock_guard lock(m_mutex);
+			m_job = &job;
+			++m_generation;
+		}
+		m_wake.notify_all();
+
+		Inside_Job() = true;
+		Execute(job);
+		Inside_Job() = false;
+
+		{
+			// the job lives on this stack: wait for every worker that joined it to leave
+			std::unique_lock lock(m_mutex);
+			m_idle.wait(lock, [this] { return m_busy == 0; });
+			m_job = nullptr;
+		}
+#if O_UTILS_HAS_EXCEPTIONS
+		if (job.error)
+			std::rethrow_exception(job.error);
+#endif
+	}
+
+	inline void Worker_Pool::Execute(Job& job)
+	{
+		for (;;)
+		{
+			const std::size_t i = job.next.fetch_add(1, std::memory_order_relaxed);
+			// claims are increasing: past the end or past a failed task, nothing is left to run
+			if (i >= job.count || i > job.failed.load(std::memory_order_relaxed))
+				return;
+
+			O_TRY
+			{
+				job.run(job.task, i);
+			}
+			O_CATCH_ALL
+			{
+#if O_UTILS_HAS_EXCEPTIONS
+				std::lock_guard lock(m_mutex);
+				if (i < job.failed.load(std::memory_order_relaxed))
+				{
+					job.failed.store(i, std::memory_order_relaxed);
+					job.error = std::current_exception();
+				}
+#endif
+			}
+		}
+	}
+
+	inline void Worker_Pool::Work_Loop()
+	{
+		Inside_Job() = true;
+		std::uint64_t seen = 0;
+		for (;;)
+		{
+			Job* job = nullptr;
+			{
+				std::unique_lock lock(m_mutex);
+				m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+				if (m_stop)
+					return;
+				seen = m_generation;
+				// woken after the caller already closed the job: nothing to join
+				if (!m_job)
+					continue;
+				job = m_job;
+				++m_busy;
+			}
+
+			Execute(*job);
+
+			{
+				std::lock_guard lock(m_mutex);
+				if (--m_busy == 0)
+					m_idle.notify_all();
+			}
+		}
+	}
+
+} // namespace O
+
+#endif // UTILS_WORKER_POOL_HPP
@@ -3,17 +3,25 @@
 
 #include <ranges>
 #include <cstddef>
+#include <span>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
 namespace O 
 {
 
-	// Zip view: iterate pairs (A&, B&) for random-access sized ranges of same size.
-	template <std::ranges::random_access_range R1, std::ranges::random_access_range R2>
-	requires std::ranges::sized_range<R1> && std::ranges::sized_range<R2>
+	// Zip view: iterate tuples (A&, B&, ...) for two or more random-access sized ranges of same size.
+	template <std::ranges::random_access_range... R>
+	requires (sizeof...(R) >= 2) && (std::ranges::sized_range<R> && ...)
 	class Zip_View;
 
+	// Element references of one position of a Zip_View: tuple-like (structured bindings, get<I>()),
+	// with `first` and `second` members when two ranges are zipped. Assigning, swapping and comparing
+	// a proxy act on the referenced elements, so zipped ranges can be sorted.
+	template <class... Refs>
+	struct Zip_Proxy;
+
 	// Zip-index view: iterate (A&, std::size_t)
 	template <std::ranges::random_access_range R>
 	requires std::ranges::sized_range<R>
@@ -27,12 +35,17 @@ namespace O
 	requires std::ranges::sized_range<R>
 	class Zip_Adjacent_View;
 
+	// Zip-window view: iterate the K consecutive elements (A&, A&, ...) starting at each position
+	template <std::ranges::random_access_range R, std::size_t K, bool circular>
+	requires std::ranges::sized_range<R> && (K >= 1)
+	class Zip_Window_View;
+
 	// Factory helpers (take lvalue references to ranges)
-	template <std::ranges::random_access_range R1, std::ranges::random_access_range R2>
-	requires std::ranges::sized_range<R1> && std::ranges::sized_range<R2>
-	constexpr Zip_View<R1, R2> Zip(R1& a, R2& b) noexcept
+	template <std::ranges::random_access_range... R>
+	requires (sizeof...(R) >= 2) && (std::ranges::sized_range<R> && ...)
+	constexpr Zip_View<R...> Zip(R&... ranges) noexcept
 	{
-		return Zip_View<R1, R2>(a, b);
+		return Zip_View<R...>(ranges...);
 	}
 
 	template <std::ranges::random_access_range R>
@@ -71,6 +84,23 @@ namespace O
 	{
 		return Zip_Adjacent_View<R,false>(a);
 	}
+
+	/**
+	 * @brief Zip the K elements a[i], a[i+1], ..., a[i+K-1] of a container to use inside a for loop
+	 *
+	 * @tparam K the window width
+	 * @tparam circular when true every element starts a window and the last ones wrap around to the front,
+	 *         otherwise the view stops at the last full window (n-K+1 windows, none when n < K)
+	 * @param a the container
+	 * @return a view whose elements are tuple-like: `for(auto&& [prev, cur, next] : O::Zip_Window<3, true>(a))`
+	 * @note wrapping is a compare and a subtraction on the index, a modulo is only taken when K exceeds the size of the range
+	 */
+	template <std::size_t K, bool circular = false, std::ranges::random_access_range R>
+	requires std::ranges::sized_range<R> && (K >= 1)
+	constexpr Zip_Window_View<R, K, circular> Zip_Window(R& a) noexcept
+	{
+		return Zip_Window_View<R, K, circular>(a);
+	}
 	
 
 	// for_each_indexed(range, func)
@@ -79,11 +109,135 @@ namespace O
 	requires std::invocable<Func&, std::ranges::range_reference_t<Range>, std::size_t>
 	constexpr void For_Each_Indexed(Range&& range, Func&& func) noexcept(noexcept(std::declval<Func&>()(*std::ranges::begin(std::declval<Range&>()), std::size_t{})));
 
-	// for_each_zip(rangeA, rangeB, func)
-	// func(a_ref, b_ref)
-	template <std::ranges::forward_range RangeA, std::ranges::forward_range RangeB, typename Func>
-	requires std::invocable<Func&, std::ranges::range_reference_t<RangeA>, std::ranges::range_reference_t<RangeB>>
-	constexpr void For_Each_Zip(RangeA&& a, RangeB&& b, Func&& func) noexcept(noexcept(std::declval<Func&>()(*std::ranges::begin(std::declval<RangeA&>()), *std::ranges::begin(std::declval<RangeB&>()))));
+	// internal: window types (K times the element reference) and index wrapping shared by Zip_Window and For_Each_Window
+	struct Zip_Window_Loop
+	{
+		template <typename T, std::size_t> using Repeat = T;
+
+		template <typename Func, typename Ref, typename Indices> struct Invocable;
+		template <typename Func, typename Ref, std::size_t... I>
+		struct Invocable<Func, Ref, std::index_sequence<I...>> : std::bool_constant<std::invocable<Func&, Repeat<Ref, I>...>> {};
+
+		template <typename Ref, typename Indices> struct Proxy;
+		template <typename Ref, std::size_t... I>
+		struct Proxy<Ref, std::index_sequence<I...>> { using Type = Zip_Proxy<Repeat<Ref, I>...>; };
+
+		template <typename Value, typename Indices> struct Values;
+		template <typename Value, std::size_t... I>
+		struct Values<Value, std::index_sequence<I...>> { using Type = std::tuple<Repeat<Value, I>...>; };
+
+		// i in [0, size + K - 1) brought back into [0, size); the modulo is only reached by windows wider than the range
+		static constexpr std::size_t Wrap(std::size_t i, std::size_t size) noexcept;
+	};
+
+	template <typename Func, typename Range, std::size_t K>
+	concept Zip_Window_Invocable = Zip_Window_Loop::Invocable<Func, std::ranges::range_reference_t<Range>, std::make_index_sequence<K>>::value;
+
+	// for_each_window<K, circular>(range, func)
+	// func(ref_0, ..., ref_K-1) for each window of Zip_Window<K, circular>(range): the windows that wrap around
+	// are peeled off the main loop, which indexes a contiguous range through its data() pointer
+	template <std::size_t K, bool circular = false, std::ranges::random_access_range Range, typename Func>
+	requires std::ranges::sized_range<Range> && (K >= 1) && Zip_Window_Invocable<Func, Range, K>
+	constexpr void For_Each_Window(Range&& range, Func&& func);
+
+	template <typename Func, typename... Ranges>
+	concept Zip_Invocable = (std::ranges::forward_range<Ranges> && ...) && std::invocable<Func&, std::ranges::range_reference_t<Ranges>...>;
+
+	// internal: For_Each_Zip() arguments split into the ranges and the trailing function
+	struct Zip_Loop
+	{
+		template <typename Args, typename Indices> struct Split;
+		template <typename... Args, std::size_t... I>
+		struct Split<std::tuple<Args...>, std::index_sequence<I...>>
+		{
+			using Func = std::tuple_element_t<sizeof...(I), std::tuple<Args...>>;
+			static constexpr bool INVOCABLE = Zip_Invocable<Func, std::tuple_element_t<I, std::tuple<Args...>>...>;
+			static constexpr bool NOTHROW = std::is_nothrow_invocable_v<Func&, std::ranges::range_reference_t<std::tuple_element_t<I, std::tuple<Args...>>>...>;
+		};
+		template <typename... Args>
+		using Split_t = Split<std::tuple<Args...>, std::make_index_sequence<sizeof...(Args) - 1>>;
+
+		template <typename All, std::size_t... I>
+		static constexpr void Run(All& all, std::index_sequence<I...>);
+		template <typename Func, typename... Ranges>
+		static constexpr void Run_Ranges(Func& func, Ranges&... ranges);
+		template <typename Func, typename... P>
+		static constexpr void Pointers(Func& func, std::size_t n, P*... p);
+		template <typename Func, typename Its, typename Ends, std::size_t... I>
+		static constexpr void Iterators(Func& func, Its its, const Ends& ends, std::index_sequence<I...>);
+	};
+
+	// for_each_zip(range_1, range_2, ..., range_n, func)
+	// func(ref_1, ref_2, ..., ref_n)
+	template <typename... Args>
+	requires (sizeof...(Args) >= 3) && Zip_Loop::Split_t<Args...>::INVOCABLE
+	constexpr void For_Each_Zip(Args&&... args) noexcept(Zip_Loop::Split_t<Args...>::NOTHROW);
+
+
+	/// Bytes of the widest SIMD register the build targets (SSE2: 16, AVX / AVX2: 32, AVX-512: 64)
+	inline constexpr std::size_t SIMD_BYTES =
+#if defined(__AVX512F__)
+		64;
+#elif defined(__AVX__)
+		32;
+#else
+		16;
+#endif
+
+	/// Elements of T in one SIMD register, the natural block width of For_Each_Zip_Batch
+	template <typename T>
+	inline constexpr std::size_t SIMD_LANES = sizeof(T) < SIMD_BYTES ? SIMD_BYTES / sizeof(T) : 1;
+
+	/// Fixed-width block of a contiguous range, as handed to the block function of the batched loops
+	template <typename Range, std::size_t W>
+	using Batch_Span_t = std::span<std::remove_reference_t<std::ranges::range_reference_t<Range>>, W>;
+
+	template <std::size_t W, typename Block, typename Tail, typename... Ranges>
+	concept Zip_Batch_Invocable = (std::ranges::contiguous_range<Ranges> && ...) && (std::ranges::sized_range<Ranges> && ...)
+		&& std::invocable<Block&, Batch_Span_t<Ranges, W>...> && std::invocable<Tail&, std::ranges::range_reference_t<Ranges>...>;
+
+	// internal: For_Each_Zip_Batch() arguments split into the ranges, the block function and the tail function
+	struct Zip_Batch_Loop
+	{
+		template <std::size_t W, typename Args, typename Indices> struct Split;
+		template <std::size_t W, typename... Args, std::size_t... I>
+		struct Split<W, std::tuple<Args...>, std::index_sequence<I...>>
+		{
+			using Block = std::tuple_element_t<sizeof...(I), std::tuple<Args...>>;
+			using Tail = std::tuple_element_t<sizeof...(I) + 1, std::tuple<Args...>>;
+			static constexpr bool INVOCABLE = Zip_Batch_Invocable<W, Block, Tail, std::tuple_element_t<I, std::tuple<Args...>>...>;
+		};
+		template <std::size_t W, typename... Args>
+		using Split_t = Split<W, std::tuple<Args...>, std::make_index_sequence<sizeof...(Args) - 2>>;
+
+		template <std::size_t W, typename All, std::size_t... I>
+		static constexpr void Run(All& all, std::index_sequence<I...>);
+	};
+
+	/**
+	 * @brief For_Each_Zip in blocks of W elements: `block(std::span<A, W>, std::span<B, W>, ...)` over every whole block,
+	 *        then `tail(a_ref, b_ref, ...)` for each of the last size % W elements.
+	 *
+	 * The block function sees a compile-time width, so its body can be written once in vector form (a fixed trip-count
+	 * loop with selects instead of branches, intrinsics or a simd type loading from span.data()) rather than relying
+	 * on the autovectorizer to see through a per-element function.
+	 *
+	 * for_each_zip_batch<W>(range_1, ..., range_n, block, tail), over contiguous sized ranges of the same size
+	 *
+	 * @tparam W Elements per block, e.g. `O::SIMD_LANES<float>`
+	 */
+	template <std::size_t W, typename... Args>
+	requires (W > 0) && (sizeof...(Args) >= 3) && Zip_Batch_Loop::Split_t<W, Args...>::INVOCABLE
+	constexpr void For_Each_Zip_Batch(Args&&... args);
+
+	/**
+	 * @brief For_Each_Indexed in blocks of W elements: `block(std::span<T, W>, first_index)` over every whole block,
+	 *        then `tail(elem_ref, index)` for each of the last size % W elements.
+	 */
+	template <std::size_t W, std::ranges::contiguous_range Range, typename Block, typename Tail>
+	requires (W > 0) && std::ranges::sized_range<Range> && std::invocable<Block&, Batch_Span_t<Range, W>, std::size_t>
+		&& std::invocable<Tail&, std::ranges::range_reference_t<Range>, std::size_t>
+	constexpr void For_Each_Indexed_Batch(Range&& range, Block&& block, Tail&& tail);
 
 } // namespace O
 
@@ -1,8 +1,12 @@
 #ifndef UTILS_ZIP_HPP
 #define UTILS_ZIP_HPP
 
+#include <algorithm>
 #include <utility>
 #include <cassert>
+#include <compare>
+#include <functional>
+#include <iterator>
 #include <tuple>
 #include <ranges>
 
@@ -10,99 +14,279 @@
 namespace O
 {
 
+	// ----------------------------- Zip_Iterator_Base -----------------------------
+	// Random-access arithmetic of the Zip iterators, which are an index `idx` over their ranges
+	template <class Derived>
+	struct Zip_Iterator_Base
+	{
+		using difference_type = std::ptrdiff_t;
+		using iterator_concept = std::random_access_iterator_tag;
+		using iterator_category = std::random_access_iterator_tag;
+		using Difference_Type = difference_type;
+		using Pointer = void;
+
+		std::size_t idx = 0;
+
+		constexpr Derived& operator++() noexcept { ++idx; return Self(); }
+		constexpr Derived operator++(int) noexcept { Derived tmp = Self(); ++idx; return tmp; }
+		constexpr Derived& operator--() noexcept { --idx; return Self(); }
+		constexpr Derived operator--(int) noexcept { Derived tmp = Self(); --idx; return tmp; }
+
+		constexpr Derived& operator+=(difference_type n) noexcept { idx += static_cast<std::size_t>(n); return Self(); }
+		constexpr Derived& operator-=(difference_type n) noexcept { idx -= static_cast<std::size_t>(n); return Self(); }
+		constexpr auto operator[](difference_type n) const noexcept { return *(Self() + n); }
+
+		friend constexpr Derived operator+(Derived it, difference_type n) noexcept { return it += n; }
+		friend constexpr Derived operator+(difference_type n, Derived it) noexcept { return it += n; }
+		friend constexpr Derived operator-(Derived it, difference_type n) noexcept { return it -= n; }
+		friend constexpr difference_type operator-(const Derived& a, const Derived& b) noexcept { return static_cast<difference_type>(a.idx - b.idx); }
+
+		friend constexpr bool operator==(const Derived& a, const Derived& b) noexcept { return a.idx == b.idx; }
+		friend constexpr auto operator<=>(const Derived& a, const Derived& b) noexcept { return a.idx <=> b.idx; }
+
+	private:
+		constexpr Derived& Self() noexcept { return static_cast<Derived&>(*this); }
+		constexpr const Derived& Self() const noexcept { return static_cast<const Derived&>(*this); }
+	};
+
+	// ----------------------------- Zip_Proxy -----------------------------
+	template <class... Refs>
+	struct Zip_Proxy_Storage
+	{
+		std::tuple<Refs...> refs;
+
+		constexpr Zip_Proxy_Storage(Refs... r) noexcept : refs(std::forward<Refs>(r)...) {}
+
+		template <std::size_t I>
+		constexpr decltype(auto) get() const noexcept { return std::get<I>(refs); }
+	};
+
+	template <class A, class B>
+	struct Zip_Proxy_Storage<A, B>
+	{
+		A first;
+		B second;
+
+		constexpr Zip_Proxy_Storage(A a, B b) noexcept : first(std::forward<A>(a)), second(std::forward<B>(b)) {}
+
+		template <std::size_t I>
+		constexpr decltype(auto) get() const noexcept
+		{
+			if constexpr (I == 0) return first;
+			else return second;
+		}
+	};
+
+	template <class... Refs>
+	struct Zip_Proxy : Zip_Proxy_Storage<Refs...>
+	{
+		using Zip_Proxy_Storage<Refs...>::Zip_Proxy_Storage;
+
+		constexpr Zip_Proxy(const Zip_Proxy&) noexcept = default;
+
+		// a copy of the referenced elements
+		template <class... T>
+		requires (sizeof...(T) == sizeof...(Refs)) && (std::constructible_from<T, Refs&> && ...)
+		constexpr operator std::tuple<T...>() const
+		{
+			return Apply([this]<std::size_t... I>(std::index_sequence<I...>) { return std::tuple<T...>(this->template get<I>()...); });
+		}
+
+		// assignments write through to the referenced elements, as for a tuple of references
+		constexpr const Zip_Proxy& operator=(const Zip_Proxy& other) const
+		{
+			Apply([&]<std::size_t... I>(std::index_sequence<I...>) { ((this->template get<I>() = other.template get<I>()), ...); });
+			return *this;
+		}
+
+		template <class... T>
+		requires (sizeof...(T) == sizeof...(Refs)) && (std::is_assignable_v<Refs, const T&> && ...)
+		constexpr const Zip_Proxy& operator=(const std::tuple<T...>& values) const
+		{
+			Apply([&]<std::size_t... I>(std::index_sequence<I...>) { ((this->template get<I>() = std::get<I>(values)), ...); });
+			return *this;
+		}
+
+		template <class... T>
+		requires (sizeof...(T) == sizeof...(Refs)) && (std::is_assignable_v<Refs, T&&> && ...)
+		constexpr const Zip_Proxy& operator=(std::tuple<T...>&& values) const
+		{
+			Apply([&]<std::size_t... I>(std::index_sequence<I...>) { ((this->template get<I>() = std::get<I>(std::move(values))), ...); });
+			return *this;
+		}
+
+		friend constexpr void swap(const Zip_Proxy& a, const Zip_Proxy& b)
+		{
+			Apply([&]<std::size_t... I>(std::index_sequence<I...>) { (std::ranges::swap(a.template get<I>(), b.template get<I>()), ...); });
+		}
+
+	private:
+		template <class F>
+		static constexpr decltype(auto) Apply(F&& f) { return std::forward<F>(f)(std::index_sequence_for<Refs...>{}); }
+	};
+
+	// get<I>(proxy), found by ADL like std::get for std::tuple (e.g. in sort projections)
+	template <std::size_t I, class... Refs>
+	constexpr decltype(auto) get(const Zip_Proxy<Refs...>& proxy) noexcept
+	{
+		return proxy.template get<I>();
+	}
+
+	// lexicographic comparisons of a Zip_Proxy with another one or with a tuple of values (its value type),
+	// so that zipped ranges sort with the default std::ranges::less
+	struct Zip_Compare
+	{
+		template <class A, class B, std::size_t... I>
+		static constexpr bool Equal(const A& a, const B& b, std::index_sequence<I...>)
+		{
+			return ((get<I>(a) == get<I>(b)) && ...);
+		}
+
+		template <class Category, class A, class B, std::size_t... I>
+		static constexpr Category Three_Way(const A& a, const B& b, std::index_sequence<I...>)
+		{
+			Category result = Category::equivalent;
+			static_cast<void>(((result = std::compare_three_way{}(get<I>(a), get<I>(b)), result == 0) && ...));
+			return result;
+		}
+
+		template <class... T>
+		using Category = std::common_comparison_category_t<std::compare_three_way_result_t<std::remove_cvref_t<T>>...>;
+	};
+
+	template <class... A, class... B>
+	requires (sizeof...(A) == sizeof...(B)) && (std::equality_comparable_with<std::remove_cvref_t<A>, std::remove_cvref_t<B>> && ...)
+	constexpr bool operator==(const Zip_Proxy<A...>& a, const Zip_Proxy<B...>& b)
+	{
+		return Zip_Compare::Equal(a, b, std::index_sequence_for<A...>{});
+	}
+
+	template <class... A, class... B>
+	requires (sizeof...(A) == sizeof...(B)) && (std::three_way_comparable_with<std::remove_cvref_t<A>, std::remove_cvref_t<B>> && ...)
+	constexpr auto operator<=>(const Zip_Proxy<A...>& a, const Zip_Proxy<B...>& b)
+	{
+		return Zip_Compare::Three_Way<Zip_Compare::Category<A...>>(a, b, std::index_sequence_for<A...>{});
+	}
+
+	template <class... A, class... T>
+	requires (sizeof...(A) == sizeof...(T)) && (std::equality_comparable_with<std::remove_cvref_t<A>, T> && ...)
+	constexpr bool operator==(const Zip_Proxy<A...>& a, const std::tuple<T...>& b)
+	{
+		return Zip_Compare::Equal(a, b, std::index_sequence_for<A...>{});
+	}
+
+	template <class... A, class... T>
+	requires (sizeof...(A) == sizeof...(T)) && (std::three_way_comparable_with<std::remove_cvref_t<A>, T> && ...)
+	constexpr auto operator<=>(const Zip_Proxy<A...>& a, const std::tuple<T...>& b)
+	{
+		return Zip_Compare::Three_Way<Zip_Compare::Category<A...>>(a, b, std::index_sequence_for<A...>{});
+	}
+
 	// ----------------------------- Zip_View -----------------------------
-	template <std::ranges::random_access_range R1, std::ranges::random_access_range R2>
-	requires std::ranges::sized_range<R1> && std::ranges::sized_range<R2>
-	class Zip_View 
+	template <std::ranges::random_access_range... R>
+	requires (sizeof...(R) >= 2) && (std::ranges::sized_range<R> && ...)
+	class Zip_View : public std::ranges::view_interface<Zip_View<R...>>
 	{
 	public:
 		using Size_Type = std::size_t;
-		using ref1_t = std::ranges::range_reference_t<R1>;
-		using ref2_t = std::ranges::range_reference_t<R2>;
-		using elem1_t = std::remove_reference_t<ref1_t>;
-		using elem2_t = std::remove_reference_t<ref2_t>;
+		using Proxy = Zip_Proxy<std::ranges::range_reference_t<R>...>;
+		using Value = std::tuple<std::ranges::range_value_t<R>...>;
 
 	private:
-		R1* m_r1;
-		R2* m_r2;
-		Size_Type m_size;
+		// contiguous range: its data() pointer, so that iterating all-contiguous ranges is a plain pointer loop;
+		// other ranges are indexed through their operator[]
+		template <class Rng>
+		static constexpr auto Base(Rng& r) noexcept
+		{
+			if constexpr (std::ranges::contiguous_range<Rng>)
+				return std::ranges::data(r);
+			else
+				return std::addressof(r);
+		}
+
+		template <class Rng, class B>
+		static constexpr std::ranges::range_reference_t<Rng> At(B base, Size_Type i) noexcept
+		{
+			if constexpr (std::ranges::contiguous_range<Rng>)
+				return base[i];
+			else
+				return (*base)[i];
+		}
+
+		template <class Rng, class B>
+		static constexpr std::ranges::range_rvalue_reference_t<Rng> Move_At(B base, Size_Type i) noexcept
+		{
+			if constexpr (std::is_reference_v<std::ranges::range_reference_t<Rng>>)
+				return std::move(At<Rng>(base, i));
+			else
+				return At<Rng>(base, i);
+		}
+
+		using Bases = std::tuple<decltype(Base(std::declval<R&>()))...>;
+
+		Bases m_bases{};
+		Size_Type m_size = 0;
 
 	public:
-		constexpr Zip_View(R1& a, R2& b) noexcept: 
-			m_r1(std::addressof(a)),
-			m_r2(std::addressof(b)),
-			m_size(static_cast<Size_Type>(std::ranges::size(a)))
+		constexpr Zip_View() noexcept = default;
+
+		constexpr Zip_View(R&... ranges) noexcept: 
+			m_bases(Base(ranges)...),
+			m_size(std::min({ static_cast<Size_Type>(std::ranges::size(ranges))... }))
 		{
-			assert(std::ranges::size(a) == std::ranges::size(b) && "Zip requires ranges of equal size");
+			assert(((static_cast<Size_Type>(std::ranges::size(ranges)) == m_size) && ...) && "Zip requires ranges of equal size");
 		}
 
-		// proxy type that is tuple-like via ADL get + std::tuple_size specialization (below)
-		struct Proxy {
-			ref1_t first;
-			ref2_t second;
-		};
+		// Random-access Iterator; dereferences to a Proxy, iter_move() moves the elements into a Value
+		struct Iterator : Zip_Iterator_Base<Iterator> {
+				using value_type = Value;
 
-		// Iterator (random-access not required; simple index Iterator)
-		struct Iterator {
-				using Difference_Type = std::ptrdiff_t;
-				using Pointer = void;
-
-				R1* r1;
-				R2* r2;
-				Size_Type idx;
-				Size_Type size;
-
-			constexpr Iterator(R1* a, R2* b, Size_Type i, Size_Type s) noexcept:
-				r1(a), 
-				r2(b), 
-				idx(i), 
-				size(s) 
-			{
+				Bases bases{};
 
-			}
+			constexpr Iterator() noexcept = default;
 
-			constexpr Proxy operator*() const noexcept
+			constexpr Iterator(const Bases& b, Size_Type i) noexcept:
+				bases(b)
 			{
-				return Proxy{ 
-					std::ranges::range_reference_t<R1>( (*r1)[idx] ),
-					std::ranges::range_reference_t<R2>( (*r2)[idx] )
-				};
+				this->idx = i;
 			}
 
-			constexpr bool operator==(const Iterator& o) const noexcept { return idx == o.idx; }
-			constexpr bool operator!=(const Iterator& o) const noexcept { return !(*this == o); }
-
-			constexpr Iterator& operator++() noexcept
+			constexpr Proxy operator*() const noexcept
 			{
-				++idx;
-				return *this;
+				return Apply([this]<std::size_t... I>(std::index_sequence<I...>) { return Proxy{ At<R>(std::get<I>(bases), this->idx)... }; });
 			}
-			constexpr Iterator operator++(int) noexcept
+
+			friend constexpr Value iter_move(const Iterator& it) noexcept(std::is_nothrow_move_constructible_v<Value>)
 			{
-				Iterator tmp = *this;
-				++(*this);
-				return tmp;
+				return Apply([&]<std::size_t... I>(std::index_sequence<I...>) { return Value(Move_At<R>(std::get<I>(it.bases), it.idx)...); });
 			}
+
+		private:
+			template <class F>
+			static constexpr decltype(auto) Apply(F&& f) { return std::forward<F>(f)(std::index_sequence_for<R...>{}); }
 		};
 
-		constexpr Iterator begin() const noexcept { return Iterator(m_r1, m_r2, 0u, m_size); }
-		constexpr Iterator end()   const noexcept { return Iterator(m_r1, m_r2, m_size, m_size); }
+		constexpr Iterator begin() const noexcept { return Iterator(m_bases, 0u); }
+		constexpr Iterator end()   const noexcept { return Iterator(m_bases, m_size); }
 		constexpr Size_Type size() const noexcept { return m_size; }
 	};
 
 	template <std::ranges::random_access_range R>
 	requires std::ranges::sized_range<R>
-	class Zip_Index_View {
+	class Zip_Index_View : public std::ranges::view_interface<Zip_Index_View<R>> {
 	public:
 		using Size_Type = std::size_t;
 		using Ref_T = std::ranges::range_reference_t<R>;
 		using Elem_T = std::remove_reference_t<Ref_T>;
+		using Value = std::tuple<std::ranges::range_value_t<R>, Size_Type>;
 
 	private:
-		R* m_r;
-		Size_Type m_size;
+		R* m_r = nullptr;
+		Size_Type m_size = 0;
 
 	public:
+		constexpr Zip_Index_View() noexcept = default;
+
 		constexpr Zip_Index_View(R& r) noexcept : 
 			m_r(std::addressof(r)),
 			m_size(static_cast<Size_Type>(std::ranges::size(r))) 
@@ -114,32 +298,30 @@ namespace O
 		{
 			Ref_T p;
 			Size_Type idx;
+
+			constexpr operator Value() const { return Value(p, idx); }
 		};
 
-		struct Iterator {
-			R* r;
-			Size_Type idx;
-			Size_Type size;
+		struct Iterator : Zip_Iterator_Base<Iterator> {
+			using value_type = Value;
+
+			R* r = nullptr;
+			Size_Type size = 0;
+
+			constexpr Iterator() noexcept = default;
 
 			constexpr Iterator(R* rr, Size_Type i, Size_Type s) noexcept : 
 				r(rr), 
-				idx(i), 
 				size(s)
 			{
-
+				this->idx = i;
 			}
 
-			constexpr bool operator==(const Iterator& o) const noexcept { return idx == o.idx; }
-			constexpr bool operator!=(const Iterator& o) const noexcept { return !(*this == o); }
-
-			constexpr Iterator& operator++() noexcept { ++idx; return *this; }
-			constexpr Iterator operator++(int) noexcept { Iterator tmp = *this; ++(*this); return tmp; }
-
 			constexpr Proxy operator*() const noexcept 
 			{
 				return Proxy{ 
-					std::ranges::range_reference_t<R>( (*r)[idx] ),
-					idx
+					std::ranges::range_reference_t<R>( (*r)[this->idx] ),
+					this->idx
 				};
 			}
 		};
@@ -151,17 +333,20 @@ namespace O
 
 	template <std::ranges::random_access_range R, bool circular>
 	requires std::ranges::sized_range<R>
-	class Zip_Adjacent_View {
+	class Zip_Adjacent_View : public std::ranges::view_interface<Zip_Adjacent_View<R, circular>> {
 	public:
 		using Size_Type = std::size_t;
 		using Ref_T = std::ranges::range_reference_t<R>;
 		using Elem_T = std::remove_reference_t<Ref_T>;
+		using Value = std::tuple<std::ranges::range_value_t<R>, std::ranges::range_value_t<R>>;
 
 	private:
-		R* m_r;
-		Size_Type m_size;
+		R* m_r = nullptr;
+		Size_Type m_size = 0;
 
 	public:
+		constexpr Zip_Adjacent_View() noexcept = default;
+
 		constexpr Zip_Adjacent_View(R& r) noexcept : 
 			m_r(std::addressof(r)),
 			m_size(static_cast<Size_Type>(std::ranges::size(r))) 
@@ -173,42 +358,147 @@ namespace O
 		{
 			Ref_T p;
 			Ref_T p_1;
+
+			constexpr operator Value() const { return Value(p, p_1); }
 		};
 
-		struct Iterator {
-			R* r;
-			Size_Type idx;
-			Size_Type size;
+		struct Iterator : Zip_Iterator_Base<Iterator> {
+			using value_type = Value;
+
+			R* r = nullptr;
+			Size_Type size = 0;
+
+			constexpr Iterator() noexcept = default;
 
 			constexpr Iterator(R* rr, Size_Type i, Size_Type s) noexcept : 
 				r(rr), 
-				idx(i), 
 				size(s)
 			{
-
+				this->idx = i;
 			}
 
-			constexpr bool operator==(const Iterator& o) const noexcept { return idx == o.idx; }
-			constexpr bool operator!=(const Iterator& o) const noexcept { return !(*this == o); }
-
-			constexpr Iterator& operator++() noexcept { ++idx; return *this; }
-			constexpr Iterator operator++(int) noexcept { Iterator tmp = *this; ++(*this); return tmp; }
-
 			constexpr Proxy operator*() const noexcept 
 			{
 				return Proxy{ 
-					std::ranges::range_reference_t<R>( (*r)[idx] ),
-					std::ranges::range_reference_t<R>( (*r)[(idx+1)%size] )
+					std::ranges::range_reference_t<R>( (*r)[this->idx] ),
+					std::ranges::range_reference_t<R>( (*r)[circular && this->idx + 1 == size ? 0 : this->idx + 1] )
 				};
 			}
 		};
 
 		constexpr Iterator begin() const noexcept { return Iterator(m_r, 0u, m_size); }
-		constexpr Iterator end()   const noexcept { return Iterator(m_r, circular ? m_size : (m_size - 1), m_size); }
-		constexpr Size_Type size() const noexcept { return circular ? m_size : (m_size - 1); }
+		constexpr Iterator end()   const noexcept { return Iterator(m_r, size(), m_size); }
+		// an empty range has no adjacent pair, circular or not
+		constexpr Size_Type size() const noexcept { return circular || m_size == 0 ? m_size : (m_size - 1); }
 	};
 
 
+	// ----------------------------- Zip_Window_View -----------------------------
+	constexpr std::size_t Zip_Window_Loop::Wrap(std::size_t i, std::size_t size) noexcept
+	{
+		if (i < size)
+			return i;
+		i -= size;
+		return i < size ? i : i % size;
+	}
+
+	template <std::ranges::random_access_range R, std::size_t K, bool circular>
+	requires std::ranges::sized_range<R> && (K >= 1)
+	class Zip_Window_View : public std::ranges::view_interface<Zip_Window_View<R, K, circular>> {
+	public:
+		using Size_Type = std::size_t;
+		using Ref_T = std::ranges::range_reference_t<R>;
+		using Proxy = typename Zip_Window_Loop::Proxy<Ref_T, std::make_index_sequence<K>>::Type;
+		using Value = typename Zip_Window_Loop::Values<std::ranges::range_value_t<R>, std::make_index_sequence<K>>::Type;
+
+	private:
+		// contiguous range: its data() pointer, other ranges are indexed through their operator[]
+		static constexpr auto Base(R& r) noexcept
+		{
+			if constexpr (std::ranges::contiguous_range<R>)
+				return std::ranges::data(r);
+			else
+				return std::addressof(r);
+		}
+
+		using Base_T = decltype(Base(std::declval<R&>()));
+
+		Base_T m_base{};
+		Size_Type m_size = 0;
+
+	public:
+		constexpr Zip_Window_View() noexcept = default;
+
+		constexpr Zip_Window_View(R& r) noexcept :
+			m_base(Base(r)),
+			m_size(static_cast<Size_Type>(std::ranges::size(r)))
+		{
+
+		}
+
+		struct Iterator : Zip_Iterator_Base<Iterator> {
+			using value_type = Value;
+
+			Base_T base{};
+			Size_Type size = 0;
+
+			constexpr Iterator() noexcept = default;
+
+			constexpr Iterator(Base_T b, Size_Type i, Size_Type s) noexcept :
+				base(b),
+				size(s)
+			{
+				this->idx = i;
+			}
+
+			constexpr Proxy operator*() const noexcept
+			{
+				return [this]<std::size_t... I>(std::index_sequence<I...>) {
+					return Proxy{ At(circular ? Zip_Window_Loop::Wrap(this->idx + I, size) : this->idx + I)... };
+				}(std::make_index_sequence<K>{});
+			}
+
+		private:
+			constexpr Ref_T At(Size_Type i) const noexcept
+			{
+				if constexpr (std::ranges::contiguous_range<R>)
+					return base[i];
+				else
+					return (*base)[i];
+			}
+		};
+
+		constexpr Iterator begin() const noexcept { return Iterator(m_base, 0u, m_size); }
+		constexpr Iterator end()   const noexcept { return Iterator(m_base, size(), m_size); }
+		// circular: one window per element; otherwise one per full window, none when the range is shorter than K
+		constexpr Size_Type size() const noexcept { return circular ? m_size : (m_size >= K ? m_size - K + 1 : 0); }
+	};
+
+	template <std::size_t K, bool circular, std::ranges::random_access_range Range, typename Func>
+	requires std::ranges::sized_range<Range> && (K >= 1) && Zip_Window_Invocable<Func, Range, K>
+	constexpr void For_Each_Window(Range&& range, Func&& func)
+	{
+		const std::size_t n = static_cast<std::size_t>(std::ranges::size(range));
+		const std::size_t full = n >= K ? n - K + 1 : 0;
+		auto at = [&](std::size_t i) -> std::ranges::range_reference_t<Range> {
+			if constexpr (std::ranges::contiguous_range<Range>)
+				return std::ranges::data(range)[i];
+			else
+				return range[i];
+		};
+
+		[&]<std::size_t... I>(std::index_sequence<I...>) {
+			// windows lying inside the range: plain offsets
+			for (std::size_t i = 0; i < full; ++i)
+				std::invoke(func, at(i + I)...);
+
+			// peeled: the windows wrapping around to the front (all of them when the range is shorter than K)
+			if constexpr (circular)
+				for (std::size_t i = full; i < n; ++i)
+					std::invoke(func, at(Zip_Window_Loop::Wrap(i + I, n))...);
+		}(std::make_index_sequence<K>{});
+	}
+
 
 	template <std::ranges::forward_range Range, typename Func>
 	requires std::invocable<Func&, std::ranges::range_reference_t<Range>, std::size_t>
@@ -238,47 +528,130 @@ namespace O
 		}
 	}
 
-	template <std::ranges::forward_range RangeA, std::ranges::forward_range RangeB, typename Func>
-	requires std::invocable<Func&, std::ranges::range_reference_t<RangeA>, std::ranges::range_reference_t<RangeB>>
-	constexpr void For_Each_Zip(RangeA&& a, RangeB&& b, Func&& func) noexcept(noexcept(std::declval<Func&>()(*std::ranges::begin(std::declval<RangeA&>()), *std::ranges::begin(std::declval<RangeB&>()))))
+	// ----------------------------- Zip_Loop -----------------------------
+	template <typename All, std::size_t... I>
+	constexpr void Zip_Loop::Run(All& all, std::index_sequence<I...>)
 	{
-		using std::begin;
-		using std::end;
-		using std::data;
-		using std::size;
+		Run_Ranges(std::get<sizeof...(I)>(all), std::get<I>(all)...);
+	}
 
-		constexpr bool a_contig = std::ranges::contiguous_range<RangeA>;
-		constexpr bool b_contig = std::ranges::contiguous_range<RangeB>;
-
-		if constexpr (a_contig && b_contig) {
-			// Fastest path: both contiguous => pointer loop
-			auto* pa = data(a);
-			auto* pb = data(b);
-			std::size_t na = static_cast<std::size_t>(size(a));
-			std::size_t nb = static_cast<std::size_t>(size(b));
-			assert(na == nb && "for_each_zip: ranges must have same size (debug assert)");
-			std::size_t n = (na < nb) ? na : nb;
-			for (std::size_t i = 0; i < n; ++i) 
-			{
-				std::invoke(func, pa[i], pb[i]);
-			}
-		} 
-		else 
+	template <typename Func, typename... Ranges>
+	constexpr void Zip_Loop::Run_Ranges(Func& func, Ranges&... ranges)
+	{
+		if constexpr ((std::ranges::contiguous_range<Ranges> && ...)) {
+			// Fastest path: all contiguous => one index over one pointer per range
+			const std::size_t n = std::min({ static_cast<std::size_t>(std::ranges::size(ranges))... });
+			assert(((static_cast<std::size_t>(std::ranges::size(ranges)) == n) && ...) && "for_each_zip: ranges must have same size (debug assert)");
+			Pointers(func, n, std::ranges::data(ranges)...);
+		}
+		else
 		{
-			// Generic iterator path
-			auto itA = begin(a);
-			auto itB = begin(b);
-			auto endA = end(a);
-			auto endB = end(b);
-			for (; itA != endA && itB != endB; ++itA, ++itB)
-			{
-				std::invoke(func, *itA, *itB);
-			}
+			// Generic iterator path, stops at the shortest range
+			Iterators(func, std::tuple(std::ranges::begin(ranges)...), std::tuple(std::ranges::end(ranges)...), std::index_sequence_for<Ranges...>{});
+		}
+	}
+
+	template <typename Func, typename... P>
+	constexpr void Zip_Loop::Pointers(Func& func, std::size_t n, P*... p)
+	{
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			std::invoke(func, p[i]...);
+		}
+	}
+
+	template <typename Func, typename Its, typename Ends, std::size_t... I>
+	constexpr void Zip_Loop::Iterators(Func& func, Its its, const Ends& ends, std::index_sequence<I...>)
+	{
+		for (; ((std::get<I>(its) != std::get<I>(ends)) && ...); (++std::get<I>(its), ...))
+		{
+			std::invoke(func, *std::get<I>(its)...);
+		}
+	}
+
+	template <typename... Args>
+	requires (sizeof...(Args) >= 3) && Zip_Loop::Split_t<Args...>::INVOCABLE
+	constexpr void For_Each_Zip(Args&&... args) noexcept(Zip_Loop::Split_t<Args...>::NOTHROW)
+	{
+		auto all = std::forward_as_tuple(args...);
+		Zip_Loop::Run(all, std::make_index_sequence<sizeof...(Args) - 1>{});
+	}
+
+	// ----------------------------- Zip_Batch_Loop -----------------------------
+	template <std::size_t W, typename All, std::size_t... I>
+	constexpr void Zip_Batch_Loop::Run(All& all, std::index_sequence<I...>)
+	{
+		auto& block = std::get<sizeof...(I)>(all);
+		auto& tail = std::get<sizeof...(I) + 1>(all);
+
+		const std::size_t n = std::min({ static_cast<std::size_t>(std::ranges::size(std::get<I>(all)))... });
+		assert(((static_cast<std::size_t>(std::ranges::size(std::get<I>(all))) == n) && ...) && "for_each_zip_batch: ranges must have same size (debug assert)");
+		const auto pointers = std::tuple(std::ranges::data(std::get<I>(all))...);
+
+		std::size_t i = 0;
+		for (; i + W <= n; i += W)
+		{
+			std::invoke(block, Batch_Span_t<std::tuple_element_t<I, All>, W>(std::get<I>(pointers) + i, W)...);
+		}
+		for (; i < n; ++i)
+		{
+			std::invoke(tail, std::get<I>(pointers)[i]...);
+		}
+	}
+
+	template <std::size_t W, typename... Args>
+	requires (W > 0) && (sizeof...(Args) >= 3) && Zip_Batch_Loop::Split_t<W, Args...>::INVOCABLE
+	constexpr void For_Each_Zip_Batch(Args&&... args)
+	{
+		auto all = std::forward_as_tuple(args...);
+		Zip_Batch_Loop::Run<W>(all, std::make_index_sequence<sizeof...(Args) - 2>{});
+	}
+
+	template <std::size_t W, std::ranges::contiguous_range Range, typename Block, typename Tail>
+	requires (W > 0) && std::ranges::sized_range<Range> && std::invocable<Block&, Batch_Span_t<Range, W>, std::size_t>
+		&& std::invocable<Tail&, std::ranges::range_reference_t<Range>, std::size_t>
+	constexpr void For_Each_Indexed_Batch(Range&& range, Block&& block, Tail&& tail)
+	{
+		auto* ptr = std::ranges::data(range);
+		const std::size_t n = static_cast<std::size_t>(std::ranges::size(range));
+
+		std::size_t i = 0;
+		for (; i + W <= n; i += W)
+		{
+			std::invoke(block, Batch_Span_t<Range, W>(ptr + i, W), i);
+		}
+		for (; i < n; ++i)
+		{
+			std::invoke(tail, ptr[i], i);
 		}
 	}
 
 } // namespace O
 
+// tuple protocol of Zip_Proxy, for structured bindings
+template <class... Refs>
+struct std::tuple_size<O::Zip_Proxy<Refs...>> : std::integral_constant<std::size_t, sizeof...(Refs)> {};
+
+template <std::size_t I, class... Refs>
+struct std::tuple_element<I, O::Zip_Proxy<Refs...>> : std::tuple_element<I, std::tuple<Refs...>> {};
+
+// the views only hold pointers to the zipped ranges: their iterators stay valid after the view is gone
+template <std::ranges::random_access_range... R>
+requires (sizeof...(R) >= 2) && (std::ranges::sized_range<R> && ...)
+inline constexpr bool std::ranges::enable_borrowed_range<O::Zip_View<R...>> = true;
+
+template <std::ranges::random_access_range R>
+requires std::ranges::sized_range<R>
+inline constexpr bool std::ranges::enable_borrowed_range<O::Zip_Index_View<R>> = true;
+
+template <std::ranges::random_access_range R, bool circular>
+requires std::ranges::sized_range<R>
+inline constexpr bool std::ranges::enable_borrowed_range<O::Zip_Adjacent_View<R, circular>> = true;
+
+template <std::ranges::random_access_range R, std::size_t K, bool circular>
+requires std::ranges::sized_range<R> && (K >= 1)
+inline constexpr bool std::ranges::enable_borrowed_range<O::Zip_Window_View<R, K, circular>> = true;
+
 
 
 #endif //UTILS_ZIP_HPP
@@ -0,0 +1,96 @@
+// File: utils/zip_parallel.h
+#ifndef UTILS_ZIP_PARALLEL_H
+#define UTILS_ZIP_PARALLEL_H
+
+#include <cstddef>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "expected.h"
+#include "worker_pool.h"
+#include "zip.h"
+
+/**
+ * @brief Parallel versions of O::For_Each_Indexed and O::For_Each_Zip.
+ *
+ * The index range is cut into chunks of `grain` consecutive elements, run on a Worker_Pool (the caller takes part).
+ * By default a chunk spans about CHUNK_BYTES of the zipped ranges, so that it stays in cache while it is processed,
+ * and inputs shorter than a chunk run serially on the calling thread.
+ *
+ * Errors come back to the caller:
+ *  - an exception thrown by `func` is rethrown once every running chunk is done;
+ *  - when `func` returns an O::Expected, the loop returns `Expected<void, E>` holding the first error.
+ * In both cases the chunks after the failing one are not started, and the error reported is the one of the
+ * lowest failing element: the one the serial loop would have reported.
+ */
+namespace O::Par
+{
+	/// Default chunk footprint, in bytes of the zipped elements
+	inline constexpr std::size_t CHUNK_BYTES = std::size_t{ 1 } << 16;
+
+	/// How a parallel loop is cut and where it runs
+	struct Schedule
+	{
+		std::size_t grain = 0;          ///< elements per chunk, 0 for about CHUNK_BYTES per chunk
+		Worker_Pool* pool = nullptr;    ///< nullptr for Worker_Pool::Shared()
+	};
+
+	/// Result of a parallel loop: `Expected<void, E>` when `func` returns an Expected, void otherwise
+	template<typename Result, bool = Is_Expected_v<std::remove_cvref_t<Result>>>
+	struct Loop_Result
+	{
+		using Type = void;
+	};
+
+	template<typename Result>
+	struct Loop_Result<Result, true>
+	{
+		using Type = Expected<void, typename std::remove_cvref_t<Result>::Error_Type>;
+	};
+
+	template<typename Result>
+	using Loop_Result_t = typename Loop_Result<Result>::Type;
+
+	// internal: chunking, scheduling and error gathering shared by the loops
+	struct Loop
+	{
+		template<typename R> static constexpr auto Base(R& range) noexcept;
+		static std::size_t Grain(const Schedule& schedule, std::size_t bytes_per_index) noexcept;
+
+		template<typename Result, typename Body>
+		static Loop_Result_t<Result> Run(const Schedule& schedule, std::size_t size, std::size_t bytes_per_index, Body&& body);
+	};
+
+	/**
+	 * @brief Parallel For_Each_Indexed: `func(range[i], i)` for every element of a random-access sized range.
+	 * @return void, or `Expected<void, E>` when `func` returns an `Expected<T, E>`
+	 */
+	template <std::ranges::random_access_range Range, typename Func>
+	requires std::ranges::sized_range<Range> && std::invocable<Func&, std::ranges::range_reference_t<Range>, std::size_t>
+	auto For_Each_Indexed(const Schedule& schedule, Range&& range, Func&& func)
+		-> Loop_Result_t<std::invoke_result_t<Func&, std::ranges::range_reference_t<Range>, std::size_t>>;
+
+	template <std::ranges::random_access_range Range, typename Func>
+	requires std::ranges::sized_range<Range> && std::invocable<Func&, std::ranges::range_reference_t<Range>, std::size_t>
+	auto For_Each_Indexed(Range&& range, Func&& func)
+		-> Loop_Result_t<std::invoke_result_t<Func&, std::ranges::range_reference_t<Range>, std::size_t>>;
+
+	/**
+	 * @brief Parallel For_Each_Zip: `func(ref_1, ..., ref_n)` over random-access sized ranges of the same size,
+	 *        `For_Each_Zip(range_1, ..., range_n, func)` or `For_Each_Zip(schedule, range_1, ..., range_n, func)`.
+	 * @return void, or `Expected<void, E>` when `func` returns an `Expected<T, E>`
+	 */
+	template <typename... Args>
+	requires (sizeof...(Args) >= 3) && Zip_Loop::Split_t<Args...>::INVOCABLE
+	auto For_Each_Zip(const Schedule& schedule, Args&&... args);
+
+	template <typename... Args>
+	requires (sizeof...(Args) >= 3) && Zip_Loop::Split_t<Args...>::INVOCABLE
+	auto For_Each_Zip(Args&&... args);
+}
+
+#include "zip_parallel.hpp"
+
+#endif //UTILS_ZIP_PARALLEL_H
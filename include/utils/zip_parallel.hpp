@@ -0,0 +1,131 @@
+#ifndef UTILS_ZIP_PARALLEL_HPP
+#define UTILS_ZIP_PARALLEL_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <limits>
+#include <mutex>
+
+#include "zip_parallel.h"
+
+namespace O::Par
+{
+
+	// --- Loop ---
+	template<typename R>
+	constexpr auto Loop::Base(R& range) noexcept
+	{
+		if constexpr (std::ranges::contiguous_range<R>)
+			return std::ranges::data(range);
+		else
+			return std::ranges::begin(range);
+	}
+
+	inline std::size_t Loop::Grain(const Schedule& schedule, std::size_t bytes_per_index) noexcept
+	{
+		if (schedule.grain)
+			return schedule.grain;
+		return std::max<std::size_t>(1, CHUNK_BYTES / std::max<std::size_t>(1, bytes_per_index));
+	}
+
+	template<typename Result, typename Body>
+	Loop_Result_t<Result> Loop::Run(const Schedule& schedule, std::size_t size, std::size_t bytes_per_index, Body&& body)
+	{
+		const std::size_t grain = Grain(schedule, bytes_per_index);
+		const std::size_t chunks = size / grain + (size % grain != 0);
+		Worker_Pool& pool = schedule.pool ? *schedule.pool : Worker_Pool::Shared();
+
+		if constexpr (std::is_void_v<Loop_Result_t<Result>>)
+		{
+			pool.Run(chunks, [&](std::size_t chunk) {
+				const std::size_t first = chunk * grain;
+				const std::size_t last = std::min(size, first + grain);
+				for (std::size_t i = first; i < last; ++i)
+					body(i);
+			});
+		}
+		else
+		{
+			// lowest chunk whose element failed, and the first error of that chunk
+			std::atomic<std::size_t> failed_chunk = std::numeric_limits<std::size_t>::max();
+			auto result = Loop_Result_t<Result>::Make_Value();
+			std::mutex result_mutex;
+
+			pool.Run(chunks, [&](std::size_t chunk) {
+				if (chunk > failed_chunk.load(std::memory_order_relaxed))
+					return;
+				const std::size_t first = chunk * grain;
+				const std::size_t last = std::min(size, first + grain);
+				for (std::size_t i = first; i < last; ++i)
+				{
+					auto outcome = body(i);
+					if (!outcome.Has_Error())
+						continue;
+					std::lock_guard lock(result_mutex);
+					if (chunk < failed_chunk.load(std::memory_order_relaxed))
+					{
+						failed_chunk.store(chunk, std::memory_order_relaxed);
+						result.Emplace_Error(std::move(outcome).Error());
+					}
+					return;
+				}
+			});
+			return result;
+		}
+	}
+
+	// --- For_Each_Indexed ---
+	template <std::ranges::random_access_range Range, typename Func>
+	requires std::ranges::sized_range<Range> && std::invocable<Func&, std::ranges::range_reference_t<Range>, std::size_t>
+	auto For_Each_Indexed(const Schedule& schedule, Range&& range, Func&& func)
+		-> Loop_Result_t<std::invoke_result_t<Func&, std::ranges::range_reference_t<Range>, std::size_t>>
+	{
+		using Result = std::invoke_result_t<Func&, std::ranges::range_reference_t<Range>, std::size_t>;
+		auto base = Loop::Base(range);
+		return Loop::Run<Result>(schedule, static_cast<std::size_t>(std::ranges::size(range)), sizeof(std::ranges::range_value_t<Range>),
+			[&](std::size_t i) -> decltype(auto) { return std::invoke(func, base[i], i); });
+	}
+
+	template <std::ranges::random_access_range Range, typename Func>
+	requires std::ranges::sized_range<Range> && std::invocable<Func&, std::ranges::range_reference_t<Range>, std::size_t>
+	auto For_Each_Indexed(Range&& range, Func&& func)
+		-> Loop_Result_t<std::invoke_result_t<Func&, std::ranges::range_reference_t<Range>, std::size_t>>
+	{
+		return Par::For_Each_Indexed(Schedule{}, std::forward<Range>(range), std::forward<Func>(func));
+	}
+
+	// --- For_Each_Zip ---
+	template <typename... Args>
+	requires (sizeof...(Args) >= 3) && Zip_Loop::Split_t<Args...>::INVOCABLE
+	auto For_Each_Zip(const Schedule& schedule, Args&&... args)
+	{
+		auto all = std::forward_as_tuple(args...);
+		return [&]<std::size_t... I>(std::index_sequence<I...>) {
+			static_assert((std::ranges::random_access_range<std::tuple_element_t<I, decltype(all)>> && ...)
+				&& (std::ranges::sized_range<std::tuple_element_t<I, decltype(all)>> && ...),
+				"O::Par::For_Each_Zip needs random-access sized ranges");
+
+			auto& func = std::get<sizeof...(I)>(all);
+			using Result = std::invoke_result_t<decltype(func), std::ranges::range_reference_t<std::tuple_element_t<I, decltype(all)>>...>;
+
+			const std::size_t size = std::min({ static_cast<std::size_t>(std::ranges::size(std::get<I>(all)))... });
+			assert(((static_cast<std::size_t>(std::ranges::size(std::get<I>(all))) == size) && ...) && "for_each_zip: ranges must have same size (debug assert)");
+
+			auto bases = std::tuple(Loop::Base(std::get<I>(all))...);
+			const std::size_t bytes = (sizeof(std::ranges::range_value_t<std::tuple_element_t<I, decltype(all)>>) + ...);
+			return Loop::Run<Result>(schedule, size, bytes,
+				[&](std::size_t i) -> decltype(auto) { return std::invoke(func, std::get<I>(bases)[i]...); });
+		}(std::make_index_sequence<sizeof...(Args) - 1>{});
+	}
+
+	template <typename... Args>
+	requires (sizeof...(Args) >= 3) && Zip_Loop::Split_t<Args...>::INVOCABLE
+	auto For_Each_Zip(Args&&... args)
+	{
+		return Par::For_Each_Zip(Schedule{}, std::forward<Args>(args)...);
+	}
+
+} // namespace O::Par
+
+#endif // UTILS_ZIP_PARALLEL_HPP
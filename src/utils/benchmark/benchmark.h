@@ -0,0 +1,62 @@
+#ifndef SRC_UTILS_BENCHMARK_H
+#define SRC_UTILS_BENCHMARK_H
+
+// STD
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <utility>
+
+/// Keeps a function out of line so that a call chain really is a chain of calls
+#if defined(__GNUC__) || defined(__clang__)
+	#define BENCH_NO_INLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+	#define BENCH_NO_INLINE __declspec(noinline)
+#else
+	#define BENCH_NO_INLINE
+#endif
+
+namespace Bench
+{
+	/**
+	 * @brief Prevent the compiler from optimizing away a computed value.
+	 * @param value the value that must be considered as used
+	 */
+	template<typename T>
+	inline void Do_Not_Optimize(T&& value) noexcept
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static volatile const void* sink;
+		sink = &value;
+#endif
+	}
+
+
+	/**
+	 * @brief Run a callable a given number of times and print the mean time per iteration.
+	 * @param name label printed in front of the result
+	 * @param iterations number of times func is called
+	 * @param func callable invoked as func(iteration_index)
+	 * @return the mean time of one iteration in nanoseconds
+	 */
+	template<typename Func>
+	double Run(const char* name, std::size_t iterations, Func&& func)
+	{
+		// warm-up
+		for (std::size_t i = 0; i < iterations / 10 + 1; ++i)
+			func(i);
+
+		const auto start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i < iterations; ++i)
+			func(i);
+		const auto stop = std::chrono::steady_clock::now();
+
+		const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(iterations);
+		std::printf("%-48s %12.3f ns/iter\n", name, ns);
+		return ns;
+	}
+} // namespace Bench
+
+#endif //SRC_UTILS_BENCHMARK_H
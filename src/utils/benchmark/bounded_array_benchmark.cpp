@@ -0,0 +1,107 @@
+// bounded_array_benchmark.cpp
+#include "utils/bounded_array.h"
+
+#include "benchmark.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+
+
+// Same layout as an int but with a user-provided copy, forces Bounded_Vector through its element-wise loop
+struct Loop_Int
+{
+	int value;
+	Loop_Int(int v) noexcept : value(v) {}
+	Loop_Int(const Loop_Int& o) noexcept : value(o.value) {}
+	Loop_Int(Loop_Int&& o) noexcept : value(o.value) {}
+	Loop_Int& operator=(const Loop_Int& o) noexcept { value = o.value; return *this; }
+	~Loop_Int() noexcept {}
+};
+
+template<typename T, std::size_t N>
+static void Bench_Copy(const char* name, std::size_t fill)
+{
+	O::Bounded_Vector<T, N> source;
+	for (std::size_t i = 0; i < fill; ++i)
+		source.Emplace_Back(static_cast<int>(i));
+
+	Bench::Run(name, 10'000'000, [&](std::size_t) {
+		O::Bounded_Vector<T, N> copy(source);
+		Bench::Do_Not_Optimize(copy);
+	});
+}
+
+// Bounding box over fixed-point coordinates, natural alignment: the vectorized loop needs a scalar tail
+template<std::size_t N>
+static void Bench_Box_Natural(const char* name, std::size_t fill)
+{
+	O::Bounded_Vector<std::int32_t, N> xs;
+	for (std::size_t i = 0; i < fill; ++i)
+		xs.Push_Back(static_cast<std::int32_t>((i * 7919) % 1000));
+
+	Bench::Run(name, 2'000'000, [&](std::size_t) {
+		Bench::Do_Not_Optimize(xs);
+		const std::int32_t* data = xs.Data();
+		std::int32_t lo = data[0], hi = data[0];
+		for (std::size_t i = 0; i < xs.Size(); ++i)
+		{
+			lo = std::min(lo, data[i]);
+			hi = std::max(hi, data[i]);
+		}
+		std::int32_t box[2] = { lo, hi };
+		Bench::Do_Not_Optimize(box);
+	});
+}
+
+// Same kernel over 64-byte aligned storage padded to whole registers
+template<std::size_t N>
+static void Bench_Box_Padded(const char* name, std::size_t fill)
+{
+	O::Bounded_Vector<std::int32_t, N, 64> xs;
+	for (std::size_t i = 0; i < fill; ++i)
+		xs.Push_Back(static_cast<std::int32_t>((i * 7919) % 1000));
+	// repeating an existing coordinate leaves the box unchanged
+	xs.Fill_Padding(xs[0]);
+
+	Bench::Run(name, 2'000'000, [&](std::size_t) {
+		Bench::Do_Not_Optimize(xs);
+		const std::int32_t* data = xs.Data();
+		std::int32_t lo = data[0], hi = data[0];
+		for (std::size_t i = 0; i < xs.Padded_Size(); ++i)
+		{
+			lo = std::min(lo, data[i]);
+			hi = std::max(hi, data[i]);
+		}
+		std::int32_t box[2] = { lo, hi };
+		Bench::Do_Not_Optimize(box);
+	});
+}
+
+int main()
+{
+	std::printf("-- copy of Bounded_Vector<.,16> holding 16 elements\n");
+	Bench_Copy<int, 16>("trivial (defaulted)", 16);
+	Bench_Copy<Loop_Int, 16>("element loop", 16);
+
+	std::printf("-- copy of Bounded_Vector<.,16> holding 4 elements\n");
+	Bench_Copy<int, 16>("trivial (defaulted)", 4);
+	Bench_Copy<Loop_Int, 16>("element loop", 4);
+
+	std::printf("-- copy of Bounded_Vector<.,256> holding 8 elements\n");
+	Bench_Copy<int, 256>("trivial (defaulted)", 8);
+	Bench_Copy<Loop_Int, 256>("element loop", 8);
+
+	std::printf("-- bounding box of Bounded_Vector<int32_t,1024> holding 1000 elements\n");
+	Bench_Box_Natural<1024>("natural alignment, scalar tail", 1000);
+	Bench_Box_Padded<1024>("64-byte aligned, padded to LANES", 1000);
+
+	std::printf("-- bounding box of Bounded_Vector<int32_t,64> holding 37 elements\n");
+	Bench_Box_Natural<64>("natural alignment, scalar tail", 37);
+	Bench_Box_Padded<64>("64-byte aligned, padded to LANES", 37);
+
+	std::printf("-- bounding box of Bounded_Vector<int32_t,64> holding 5 elements\n");
+	Bench_Box_Natural<64>("natural alignment, scalar tail", 5);
+	Bench_Box_Padded<64>("64-byte aligned, padded to LANES", 5);
+	return 0;
+}
@@ -0,0 +1,67 @@
+// error_code_benchmark.cpp
+#include "utils/error_code.h"
+#include "utils/expected.h"
+
+#include "benchmark.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+
+enum class Parse_Error : std::int32_t { NOT_A_NUMBER = 1 };
+
+template<>
+struct O::Error_Code_Enum<Parse_Error>
+{
+	static constexpr bool ENABLED = true;
+	static constexpr std::uint32_t CATEGORY = 1;
+};
+
+// Same parser, two error types: the message is built on the error path, or only a code is returned
+BENCH_NO_INLINE O::Expected<int, std::string> Parse_With_String(const std::string& field)
+{
+	int value = 0;
+	for (char c : field)
+	{
+		if (c < '0' || c > '9') return O::Expected<int, std::string>(O::error_tag, "not a number: '" + field + "'");
+		value = value * 10 + (c - '0');
+	}
+	return value;
+}
+
+BENCH_NO_INLINE O::Expected<int, O::Error_Code> Parse_With_Code(const std::string& field)
+{
+	int value = 0;
+	for (char c : field)
+	{
+		if (c < '0' || c > '9') return Parse_Error::NOT_A_NUMBER;
+		value = value * 10 + (c - '0');
+	}
+	return value;
+}
+
+int main()
+{
+	// half of the rows are malformed and silently dropped
+	std::vector<std::string> fields;
+	for (int i = 0; i < 4096; ++i)
+		fields.push_back(i % 2 ? std::to_string(i) : "row-" + std::to_string(i));
+
+	std::printf("-- sizeof(Expected<int, std::string>) = %zu, sizeof(Expected<int, O::Error_Code>) = %zu\n",
+		sizeof(O::Expected<int, std::string>), sizeof(O::Expected<int, O::Error_Code>));
+	std::printf("-- %zu fields, 50%% malformed, errors discarded\n", fields.size());
+	Bench::Run("Expected<int, std::string>", 2000, [&](std::size_t) {
+		long sum = 0;
+		for (const std::string& f : fields)
+			if (auto v = Parse_With_String(f)) sum += v.Value();
+		Bench::Do_Not_Optimize(sum);
+	});
+	Bench::Run("Expected<int, O::Error_Code>", 2000, [&](std::size_t) {
+		long sum = 0;
+		for (const std::string& f : fields)
+			if (auto v = Parse_With_Code(f)) sum += v.Value();
+		Bench::Do_Not_Optimize(sum);
+	});
+	return 0;
+}
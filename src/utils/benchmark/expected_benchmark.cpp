@@ -0,0 +1,60 @@
+// expected_benchmark.cpp
+#include "utils/expected.h"
+
+#include "benchmark.h"
+
+#include <cstdio>
+#include <type_traits>
+
+
+enum class Chain_Error : unsigned char { NEGATIVE = 1 };
+
+// Same layout as a double but with a user-provided destructor: Expected falls back to its manual (memory-returned) special members
+struct Boxed_Double
+{
+	double value;
+	Boxed_Double(double v) noexcept : value(v) {}
+	Boxed_Double(const Boxed_Double& o) noexcept : value(o.value) {}
+	Boxed_Double(Boxed_Double&& o) noexcept : value(o.value) {}
+	~Boxed_Double() noexcept {}
+	operator double() const noexcept { return value; }
+};
+
+constexpr int CHAIN_DEPTH = 16;
+
+// Every level calls the next one and propagates its error, or adds to its value
+template<typename Value, int Depth>
+BENCH_NO_INLINE O::Expected<Value, Chain_Error> Chain(double x)
+{
+	if constexpr (Depth == 0)
+	{
+		if (x < 0.0) return O::Expected<Value, Chain_Error>::Make_Error(Chain_Error::NEGATIVE);
+		return O::Expected<Value, Chain_Error>::Make_Value(x * 0.5);
+	}
+	else
+	{
+		O::Expected<Value, Chain_Error> next = Chain<Value, Depth - 1>(x);
+		if (!next) return next;
+		return O::Expected<Value, Chain_Error>::Make_Value(static_cast<double>(next.Value()) + 1.0);
+	}
+}
+
+template<typename Value>
+static void Bench_Chain(const char* name)
+{
+	Bench::Run(name, 5'000'000, [](std::size_t i) {
+		// one call in eight fails at the bottom of the chain
+		const double x = (i & 7) == 0 ? -1.0 : static_cast<double>(i & 1023);
+		auto result = Chain<Value, CHAIN_DEPTH>(x);
+		Bench::Do_Not_Optimize(result);
+	});
+}
+
+int main()
+{
+	std::printf("-- Expected<., Chain_Error> returned through %d calls\n", CHAIN_DEPTH);
+	std::printf("   sizeof(Expected<double, Chain_Error>) = %zu, trivially copyable = %d\n", sizeof(O::Expected<double, Chain_Error>), std::is_trivially_copyable_v<O::Expected<double, Chain_Error>> ? 1 : 0);
+	Bench_Chain<Boxed_Double>("non-trivial payload (returned in memory)");
+	Bench_Chain<double>("trivial payload (returned in registers)");
+	return 0;
+}
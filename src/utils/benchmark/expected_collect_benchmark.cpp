@@ -0,0 +1,48 @@
+// expected_collect_benchmark.cpp
+#include "utils/expected_collect.h"
+
+#include "benchmark.h"
+
+#include <cstdio>
+#include <vector>
+
+
+enum class Parse_Error : unsigned char { NEGATIVE = 1 };
+
+using Parsed = O::Expected<double, Parse_Error>;
+
+// Batch validation as two loops: check every element, then extract the values
+BENCH_NO_INLINE O::Expected<std::vector<double>, Parse_Error> Two_Passes(const std::vector<Parsed>& batch)
+{
+	for (const Parsed& p : batch)
+		if (!p) return O::Expected<std::vector<double>, Parse_Error>(O::error_tag, p.Error());
+	std::vector<double> values;
+	values.reserve(batch.size());
+	for (const Parsed& p : batch)
+		values.push_back(p.Value());
+	return values;
+}
+
+BENCH_NO_INLINE O::Expected<std::vector<double>, Parse_Error> Single_Pass(const std::vector<Parsed>& batch)
+{
+	return O::Collect(batch);
+}
+
+int main()
+{
+	// large enough for the batch to leave the L2 cache between the two loops
+	std::vector<Parsed> batch;
+	for (std::size_t i = 0; i < (1u << 18); ++i)
+		batch.push_back(static_cast<double>(i) * 0.5);
+
+	std::printf("-- %zu valid Expected<double, E> turned into one Expected<std::vector<double>, E>\n", batch.size());
+	Bench::Run("check loop, then extract loop", 200, [&](std::size_t) {
+		auto values = Two_Passes(batch);
+		Bench::Do_Not_Optimize(values);
+	});
+	Bench::Run("O::Collect (single pass)", 200, [&](std::size_t) {
+		auto values = Single_Pass(batch);
+		Bench::Do_Not_Optimize(values);
+	});
+	return 0;
+}
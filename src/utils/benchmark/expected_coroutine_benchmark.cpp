@@ -0,0 +1,71 @@
+// expected_coroutine_benchmark.cpp
+#include "utils/expected_coroutine.h"
+
+#include "benchmark.h"
+
+#include <cstdio>
+#include <string>
+
+
+enum class Load_Error : unsigned char { NEGATIVE = 1, TOO_LARGE };
+
+struct Record
+{
+	std::string name;
+	double weight;
+	int id;
+};
+
+// The fallible steps of a loader, kept out of line so that both versions pay the same calls
+BENCH_NO_INLINE O::Expected<int, Load_Error> Parse_Id(std::size_t i)
+{
+	if ((i & 15) == 0) return Load_Error::NEGATIVE;
+	return static_cast<int>(i & 1023);
+}
+
+BENCH_NO_INLINE O::Expected<double, Load_Error> Parse_Weight(int id)
+{
+	if (id > 1000) return Load_Error::TOO_LARGE;
+	return id * 0.25;
+}
+
+BENCH_NO_INLINE O::Expected<std::string, Load_Error> Parse_Name(int id)
+{
+	return std::string("record-name-") + std::to_string(id);
+}
+
+// Early-return ladder written by hand
+BENCH_NO_INLINE O::Expected<Record, Load_Error> Load_By_Hand(std::size_t i)
+{
+	auto id = Parse_Id(i);
+	if (!id) return O::Expected<Record, Load_Error>(O::error_tag, id.Error());
+	auto weight = Parse_Weight(id.Value());
+	if (!weight) return O::Expected<Record, Load_Error>(O::error_tag, weight.Error());
+	auto name = Parse_Name(id.Value());
+	if (!name) return O::Expected<Record, Load_Error>(O::error_tag, name.Error());
+	return O::Expected<Record, Load_Error>::Make_Value(Record{ std::move(name).Value(), weight.Value(), id.Value() });
+}
+
+// Same loader as a coroutine
+BENCH_NO_INLINE O::Expected<Record, Load_Error> Load_Coroutine(std::size_t i)
+{
+	const int id = co_await Parse_Id(i);
+	const double weight = co_await Parse_Weight(id);
+	std::string name = co_await Parse_Name(id);
+	co_return Record{ std::move(name), weight, id };
+}
+
+int main()
+{
+	std::printf("-- loader of 3 fallible steps, one call in sixteen fails at the first step\n");
+	Bench::Run("hand-written early returns", 5'000'000, [](std::size_t i) {
+		auto record = Load_By_Hand(i);
+		Bench::Do_Not_Optimize(record);
+	});
+	Bench::Run("coroutine co_await (pooled frames)", 5'000'000, [](std::size_t i) {
+		auto record = Load_Coroutine(i);
+		Bench::Do_Not_Optimize(record);
+	});
+	std::printf("   frames cached after the run: %zu\n", O::Coroutine_Frame_Pool::Cached_Frames());
+	return 0;
+}
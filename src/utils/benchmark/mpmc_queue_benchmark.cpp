@@ -0,0 +1,76 @@
+// mpmc_queue_benchmark.cpp
+#include "utils/mpmc_queue.h"
+
+#include "benchmark.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+
+// producers and consumers hammer the same queue, the number of transfers is fixed
+static double Run_Contention(unsigned producers, unsigned consumers, std::size_t total)
+{
+	O::Mpmc_Queue<std::size_t, 1024> queue;
+	const std::size_t per_producer = total / producers;
+	std::atomic<std::size_t> consumed{ 0 };
+	std::atomic<bool> start{ false };
+
+	std::vector<std::thread> pool;
+	for (unsigned p = 0; p < producers; ++p)
+		pool.emplace_back([&] {
+			while (!start.load(std::memory_order_acquire)) {}
+			for (std::size_t i = 0; i < per_producer; )
+			{
+				if (queue.Try_Push(i))
+					++i;
+				else
+					std::this_thread::yield();
+			}
+		});
+	for (unsigned c = 0; c < consumers; ++c)
+		pool.emplace_back([&] {
+			while (!start.load(std::memory_order_acquire)) {}
+			std::size_t sink = 0;
+			while (consumed.load(std::memory_order_relaxed) < per_producer * producers)
+			{
+				if (auto v = queue.Try_Pop())
+				{
+					sink += v.Value();
+					consumed.fetch_add(1, std::memory_order_relaxed);
+				}
+				else
+					std::this_thread::yield();
+			}
+			Bench::Do_Not_Optimize(sink);
+		});
+
+	const auto begin = std::chrono::steady_clock::now();
+	start.store(true, std::memory_order_release);
+	for (auto& t : pool)
+		t.join();
+	const auto stop = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(stop - begin).count() / static_cast<double>(per_producer * producers);
+}
+
+int main()
+{
+	constexpr std::size_t TOTAL = 4'000'000;
+	const unsigned cores = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+
+	// from one producer + one consumer up to all cores, half producing and half consuming
+	std::printf("-- Mpmc_Queue<size_t,1024>, %zu transfers, %u cores\n", TOTAL, cores);
+	for (unsigned threads = 2; ; threads *= 2)
+	{
+		if (threads > cores && threads != 2)
+			threads = cores;
+		const unsigned producers = threads / 2;
+		const unsigned consumers = threads - producers;
+		std::printf("%3u producers %3u consumers %12.3f ns/transfer\n", producers, consumers, Run_Contention(producers, consumers, TOTAL));
+		if (threads >= cores)
+			break;
+	}
+	return 0;
+}
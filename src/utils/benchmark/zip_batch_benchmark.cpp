@@ -0,0 +1,60 @@
+// zip_batch_benchmark.cpp
+#include "utils/zip.h"
+
+#include "benchmark.h"
+
+#include <cstdio>
+#include <vector>
+
+
+using Column = std::vector<float>;
+
+constexpr std::size_t W = O::SIMD_LANES<float>;
+
+// Thresholded update: only the points above their limit move, the others are left untouched.
+// Per element this is a branch around a store, which the autovectorizer does not turn into SIMD.
+BENCH_NO_INLINE void Per_Element(Column& out, const Column& x, const Column& limit)
+{
+	O::For_Each_Zip(out, x, limit, [](float& o, float xi, float li) {
+		if (xi > li)
+			o = (xi - li) * 0.5f + li;
+	});
+}
+
+// Same kernel written once for a block of W lanes, with no control flow: the select is a 0/1 mask
+// (a float ternary stays a branch under GCC's default -ftrapping-math), and the block is stored after
+// every lane is loaded, since the spans may alias. Both loops become a handful of SIMD instructions.
+BENCH_NO_INLINE void Batched(Column& out, const Column& x, const Column& limit)
+{
+	O::For_Each_Zip_Batch<W>(out, x, limit,
+		[](std::span<float, W> o, std::span<const float, W> xs, std::span<const float, W> ls) {
+			float r[W];
+			for (std::size_t j = 0; j < W; ++j)
+			{
+				const float moved = (xs[j] - ls[j]) * 0.5f + ls[j];
+				r[j] = o[j] + static_cast<float>(xs[j] > ls[j]) * (moved - o[j]);
+			}
+			for (std::size_t j = 0; j < W; ++j)
+				o[j] = r[j];
+		},
+		[](float& o, float xi, float li) {
+			if (xi > li)
+				o = (xi - li) * 0.5f + li;
+		});
+}
+
+int main()
+{
+	const std::size_t n = (1u << 16) + 3;
+	Column out(n), x(n), limit(n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		x[i] = static_cast<float>((i * 7919) % 1000);
+		limit[i] = 500.f;
+	}
+
+	std::printf("-- %zu points, %zu-byte SIMD registers (%zu floats per block)\n", n, O::SIMD_BYTES, W);
+	Bench::Run("For_Each_Zip, branch per element", 4000, [&](std::size_t) { Per_Element(out, x, limit); Bench::Do_Not_Optimize(out); });
+	Bench::Run("For_Each_Zip_Batch, select per block", 4000, [&](std::size_t) { Batched(out, x, limit); Bench::Do_Not_Optimize(out); });
+	return 0;
+}
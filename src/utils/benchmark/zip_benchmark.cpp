@@ -0,0 +1,66 @@
+// zip_benchmark.cpp
+#include "utils/zip.h"
+
+#include "benchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <execution>
+#include <vector>
+
+
+using Column = std::vector<float>;
+
+// Weighted squared norm of four columns into a fifth, written the three ways a kernel can be written
+BENCH_NO_INLINE void Nested(Column& out, const Column& x, const Column& y, const Column& z, const Column& w)
+{
+	// two-range Zip, the other columns indexed by hand
+	std::size_t i = 0;
+	for (auto&& [oi, xi] : O::Zip(out, x))
+	{
+		oi = (xi * xi + y[i] * y[i] + z[i] * z[i]) * w[i];
+		++i;
+	}
+}
+
+BENCH_NO_INLINE void Variadic_Zip(Column& out, const Column& x, const Column& y, const Column& z, const Column& w)
+{
+	for (auto&& [oi, xi, yi, zi, wi] : O::Zip(out, x, y, z, w))
+		oi = (xi * xi + yi * yi + zi * zi) * wi;
+}
+
+BENCH_NO_INLINE void Variadic_For_Each(Column& out, const Column& x, const Column& y, const Column& z, const Column& w)
+{
+	O::For_Each_Zip(out, x, y, z, w, [](float& oi, float xi, float yi, float zi, float wi) {
+		oi = (xi * xi + yi * yi + zi * zi) * wi;
+	});
+}
+
+BENCH_NO_INLINE void Standard_Algorithm(Column& out, const Column& x, const Column& y, const Column& z, const Column& w)
+{
+	auto rows = O::Zip(x, y, z, w);
+	std::transform(std::execution::unseq, rows.begin(), rows.end(), out.begin(), [](const auto& row) {
+		auto&& [xi, yi, zi, wi] = row;
+		return (xi * xi + yi * yi + zi * zi) * wi;
+	});
+}
+
+int main()
+{
+	const std::size_t n = 1u << 16;
+	Column out(n), x(n), y(n), z(n), w(n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		x[i] = static_cast<float>(i % 7);
+		y[i] = static_cast<float>(i % 5);
+		z[i] = static_cast<float>(i % 3);
+		w[i] = 1.f / static_cast<float>(1 + i % 11);
+	}
+
+	std::printf("-- x, y, z, weight columns of %zu floats\n", n);
+	Bench::Run("Zip(out, x) + y[i], z[i], w[i]", 2000, [&](std::size_t) { Nested(out, x, y, z, w); Bench::Do_Not_Optimize(out); });
+	Bench::Run("Zip(out, x, y, z, w)", 2000, [&](std::size_t) { Variadic_Zip(out, x, y, z, w); Bench::Do_Not_Optimize(out); });
+	Bench::Run("For_Each_Zip(out, x, y, z, w, f)", 2000, [&](std::size_t) { Variadic_For_Each(out, x, y, z, w); Bench::Do_Not_Optimize(out); });
+	Bench::Run("std::transform(unseq, Zip(x, y, z, w))", 2000, [&](std::size_t) { Standard_Algorithm(out, x, y, z, w); Bench::Do_Not_Optimize(out); });
+	return 0;
+}
@@ -0,0 +1,42 @@
+// zip_parallel_benchmark.cpp
+#include "utils/zip_parallel.h"
+
+#include "benchmark.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+
+using Column = std::vector<float>;
+
+// per-vertex transform: rotate around z and scale, over columns of 10M points
+static constexpr auto Transform = [](float& x, float& y, float& z, float w)
+{
+	const float c = std::cos(w), s = std::sin(w);
+	const float rx = c * x - s * y;
+	y = (s * x + c * y) * 1.01f;
+	x = rx * 1.01f;
+	z *= 1.01f;
+};
+
+int main()
+{
+	const std::size_t n = 10'000'000;
+	Column x(n, 1.f), y(n, 2.f), z(n, 3.f), w(n, 0.001f);
+
+	std::printf("-- %zu vertices, per-vertex transform over 4 columns, %zu threads in the shared pool\n", n, O::Worker_Pool::Shared().Concurrency());
+	Bench::Run("O::For_Each_Zip (serial)", 10, [&](std::size_t) {
+		O::For_Each_Zip(x, y, z, w, Transform);
+		Bench::Do_Not_Optimize(x);
+	});
+	Bench::Run("O::Par::For_Each_Zip (default grain)", 10, [&](std::size_t) {
+		O::Par::For_Each_Zip(x, y, z, w, Transform);
+		Bench::Do_Not_Optimize(x);
+	});
+	Bench::Run("O::Par::For_Each_Zip (grain 256)", 10, [&](std::size_t) {
+		O::Par::For_Each_Zip(O::Par::Schedule{ .grain = 256 }, x, y, z, w, Transform);
+		Bench::Do_Not_Optimize(x);
+	});
+	return 0;
+}
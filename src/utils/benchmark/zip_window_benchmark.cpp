@@ -0,0 +1,67 @@
+// zip_window_benchmark.cpp
+#include "utils/zip.h"
+
+#include "benchmark.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+
+struct Point
+{
+	float x;
+	float y;
+};
+
+using Polyline = std::vector<Point>;
+
+// Bending energy of a closed polyline: squared second difference over each 3-point window
+inline float Bend(const Point& prev, const Point& cur, const Point& next) noexcept
+{
+	const float dx = prev.x - 2.f * cur.x + next.x;
+	const float dy = prev.y - 2.f * cur.y + next.y;
+	return dx * dx + dy * dy;
+}
+
+// Index arithmetic with a modulo per neighbour, as the adjacent view used to do
+BENCH_NO_INLINE float Modulo(const Polyline& p)
+{
+	const std::size_t n = p.size();
+	float energy = 0.f;
+	for (std::size_t i = 0; i < n; ++i)
+		energy += Bend(p[i], p[(i + 1) % n], p[(i + 2) % n]);
+	return energy;
+}
+
+BENCH_NO_INLINE float Window_View(const Polyline& p)
+{
+	float energy = 0.f;
+	for (auto&& [prev, cur, next] : O::Zip_Window<3, true>(p))
+		energy += Bend(prev, cur, next);
+	return energy;
+}
+
+BENCH_NO_INLINE float Window_Loop(const Polyline& p)
+{
+	float energy = 0.f;
+	O::For_Each_Window<3, true>(p, [&](const Point& prev, const Point& cur, const Point& next) { energy += Bend(prev, cur, next); });
+	return energy;
+}
+
+int main()
+{
+	const std::size_t n = 1u << 16;
+	Polyline p(n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		const float angle = 6.2831853f * static_cast<float>(i) / static_cast<float>(n);
+		p[i] = { std::cos(angle) * (1.f + 0.1f * static_cast<float>(i % 7)), std::sin(angle) };
+	}
+
+	std::printf("-- closed polyline of %zu points, 3-point windows\n", n);
+	Bench::Run("index % n", 2000, [&](std::size_t) { Bench::Do_Not_Optimize(Modulo(p)); });
+	Bench::Run("Zip_Window<3, true>", 2000, [&](std::size_t) { Bench::Do_Not_Optimize(Window_View(p)); });
+	Bench::Run("For_Each_Window<3, true>", 2000, [&](std::size_t) { Bench::Do_Not_Optimize(Window_Loop(p)); });
+	return 0;
+}
@@ -2,9 +2,18 @@
 #include <gtest/gtest.h>
 
 #include "utils/bounded_array.h"
-
+#include "exception_utils_test.h"
+
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <limits>
+#include <list>
+#include <memory>
 #include <numeric>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 using namespace std;
 
@@ -41,6 +50,17 @@ TEST(Bounded_Vector, Default_Constructed_Empty)
     EXPECT_FALSE(v.Full());
 }
 
+TEST(Bounded_Vector, Zero_Capacity_Is_Always_Full)
+{
+    O::Bounded_Vector<std::string, 0> v;
+    EXPECT_EQ(v.Capacity(), 0u);
+    EXPECT_TRUE(v.Empty());
+    EXPECT_TRUE(v.Full());
+    EXPECT_EQ(v.begin(), v.end());
+    EXPECT_EQ(v.Try_Emplace_Back("x").Error(), O::Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+    O_EXPECT_THROW(v.Push_Back("x"), O::Bounded_Vector_Exception);
+}
+
 // Fill to capacity and check Full/Empty/Size
 TEST(Bounded_Vector, Fill_And_Full)
 {
@@ -64,6 +84,31 @@ TEST(Bounded_Vector, Initializer_List)
     EXPECT_EQ(v.Size(), 3u);
 }
 
+/* ------------------------
+   Size field width
+   ------------------------ */
+static_assert(std::is_same_v<O::Bounded_Size_t<16>, std::uint8_t>);
+static_assert(std::is_same_v<O::Bounded_Size_t<255>, std::uint8_t>);
+static_assert(std::is_same_v<O::Bounded_Size_t<256>, std::uint16_t>);
+static_assert(std::is_same_v<O::Bounded_Size_t<65536>, std::uint32_t>);
+static_assert(sizeof(O::Bounded_Vector<std::uint8_t, 16>) == 17);
+static_assert(sizeof(O::Bounded_Vector<char, 300>) == 302);
+static_assert(sizeof(O::Bounded_Vector<std::uint16_t, 100>) == 202);
+static_assert(sizeof(O::Bounded_Vector<int, 8>) == 36);
+static_assert(sizeof(O::Bounded_Vector<double, 4>) == 40);
+
+TEST(Bounded_Vector, Narrow_Size_Counts_To_Capacity)
+{
+    O::Bounded_Vector<std::uint8_t, 255> v;
+    for (int i = 0; i < 255; ++i)
+        v.Push_Back(static_cast<std::uint8_t>(i));
+    EXPECT_TRUE(v.Full());
+    EXPECT_EQ(v.Size(), 255u);
+    O_EXPECT_THROW(v.Push_Back(0), O::Bounded_Vector_Exception);
+    v.Clear();
+    EXPECT_TRUE(v.Empty());
+}
+
 /* ------------------------
    Element access
    ------------------------ */
@@ -78,10 +123,10 @@ TEST(Bounded_Vector, Operator_Bracket_And_At)
     EXPECT_EQ(v[1], "bc");
 
     // At() should throw on out-of-range
-    EXPECT_THROW(v.At(5), O::Bounded_Vector_Exception);
+    O_EXPECT_THROW(v.At(5), O::Bounded_Vector_Exception);
 
     // valid At
-    EXPECT_NO_THROW({
+    O_EXPECT_NO_THROW({
         auto &s = v.At(1);
         EXPECT_EQ(s, "bc");
     });
@@ -93,7 +138,7 @@ TEST(Bounded_Vector, Operator_Bracket_And_At)
 TEST(Bounded_Vector, Push_Emplace_Pop_Clear_And_Exceptions)
 {
     O::Bounded_Vector<int, 2> v;
-    EXPECT_THROW({
+    O_EXPECT_THROW({
         // popping empty -> exception
         v.Pop_Back();
     }, typename O::Bounded_Vector_Exception);
@@ -103,12 +148,7 @@ TEST(Bounded_Vector, Push_Emplace_Pop_Clear_And_Exceptions)
     EXPECT_TRUE(v.Full());
 
     // pushing past capacity -> exception
-    try {
-        v.Push_Back(3);
-        FAIL() << "Expected push to throw";
-    } catch (const O::Bounded_Vector_Exception& ex) {
-        EXPECT_EQ(ex, O::Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
-    }
+    O_EXPECT_THROW_VALUE(v.Push_Back(3), O::Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
 
     // Pop then Push works
     v.Pop_Back();
@@ -167,6 +207,40 @@ TEST(Bounded_Vector, Copy_Constructor_And_Assignment)
 }
 
 TEST(Bounded_Vector, Move_Constructor_Leaves_Source_Empty)
+{
+    O::Bounded_Vector<std::string, 5> a;
+    a.Push_Back("eleven");
+    a.Push_Back("twenty-two");
+
+    O::Bounded_Vector<std::string, 5> b(std::move(a));
+    EXPECT_EQ(b.Size(), 2u);
+    EXPECT_EQ(b[0], "eleven");
+    EXPECT_EQ(b[1], "twenty-two");
+
+    // moved-from should be empty
+    EXPECT_EQ(a.Size(), 0u);
+
+    // move assign
+    O::Bounded_Vector<std::string, 5> c;
+    c = std::move(b);
+    EXPECT_EQ(c.Size(), 2u);
+    EXPECT_EQ(b.Size(), 0u);
+}
+
+/* ------------------------
+   Trivially copyable fast path
+   ------------------------ */
+struct Plain_Point { double x; double y; };
+
+static_assert(std::is_trivially_copyable_v<O::Bounded_Vector<int, 8>>);
+static_assert(std::is_trivially_copyable_v<O::Bounded_Vector<Plain_Point, 16>>);
+static_assert(std::is_trivially_destructible_v<O::Bounded_Vector<double, 4>>);
+static_assert(std::is_trivially_copy_constructible_v<O::Bounded_Vector<int, 8>>);
+static_assert(std::is_trivially_move_assignable_v<O::Bounded_Vector<int, 8>>);
+static_assert(!std::is_trivially_copyable_v<O::Bounded_Vector<std::string, 4>>);
+static_assert(!std::is_trivially_destructible_v<O::Bounded_Vector<Trackable, 4>>);
+
+TEST(Bounded_Vector, Trivial_Move_Keeps_Source_Elements)
 {
     O::Bounded_Vector<int, 5> a;
     a.Push_Back(11);
@@ -177,14 +251,238 @@ TEST(Bounded_Vector, Move_Constructor_Leaves_Source_Empty)
     EXPECT_EQ(b[0], 11);
     EXPECT_EQ(b[1], 22);
 
-    // moved-from should be empty
-    EXPECT_EQ(a.Size(), 0u);
+    // trivially copyable: a move is a plain copy, the source is left untouched
+    EXPECT_EQ(a.Size(), 2u);
 
-    // move assign
     O::Bounded_Vector<int, 5> c;
     c = std::move(b);
     EXPECT_EQ(c.Size(), 2u);
-    EXPECT_EQ(b.Size(), 0u);
+    EXPECT_EQ(c[1], 22);
+}
+
+TEST(Bounded_Vector, Trivial_Memcpy_Round_Trip)
+{
+    O::Bounded_Vector<Plain_Point, 4> a;
+    a.Push_Back({ 1.0, 2.0 });
+    a.Push_Back({ 3.0, 4.0 });
+
+    O::Bounded_Vector<Plain_Point, 4> b;
+    std::memcpy(static_cast<void*>(&b), &a, sizeof(a));
+    ASSERT_EQ(b.Size(), 2u);
+    EXPECT_EQ(b[0].x, 1.0);
+    EXPECT_EQ(b[1].y, 4.0);
+}
+
+/* ------------------------
+   Bulk modifiers
+   ------------------------ */
+TEST(Bounded_Vector, Append_Range_Checks_Capacity_Once)
+{
+    O::Bounded_Vector<int, 5> v(1);
+    std::vector<int> src{ 2, 3, 4 };
+    v.Append(src);
+    ASSERT_EQ(v.Size(), 4u);
+    EXPECT_EQ(v[3], 4);
+
+    // does not fit: nothing is appended
+    O_EXPECT_THROW_VALUE(v.Append(src), O::Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+    EXPECT_EQ(v.Size(), 4u);
+
+    std::list<int> non_contiguous{ 5 };
+    v.Append(non_contiguous);
+    EXPECT_TRUE(v.Full());
+    EXPECT_EQ(v[4], 5);
+}
+
+TEST(Bounded_Vector, Append_Non_Trivial)
+{
+    O::Bounded_Vector<std::string, 4> v;
+    std::array<std::string, 2> src{ "a", "b" };
+    v.Append(src);
+    v.Append(src);
+    ASSERT_EQ(v.Size(), 4u);
+    EXPECT_EQ(v[2], "a");
+    EXPECT_EQ(src[0], "a");
+}
+
+TEST(Bounded_Vector, Insert_Range_Trivial_And_Non_Trivial)
+{
+    O::Bounded_Vector<int, 8> v(1, 2, 5, 6);
+    std::array<int, 2> mid{ 3, 4 };
+    int* inserted = v.Insert(v.begin() + 2, mid);
+    EXPECT_EQ(inserted, v.begin() + 2);
+    EXPECT_TRUE(std::ranges::equal(v, std::array{ 1, 2, 3, 4, 5, 6 }));
+
+    O::Bounded_Vector<std::string, 6> s(std::string("a"), std::string("d"));
+    std::vector<std::string> bc{ "b", "c" };
+    s.Insert(s.begin() + 1, bc);
+    ASSERT_EQ(s.Size(), 4u);
+    EXPECT_EQ(s[0], "a");
+    EXPECT_EQ(s[1], "b");
+    EXPECT_EQ(s[2], "c");
+    EXPECT_EQ(s[3], "d");
+
+    // insert at end and at front
+    s.Insert(s.end(), std::vector<std::string>{ "e" });
+    s.Insert(s.begin(), std::vector<std::string>{ "0" });
+    EXPECT_EQ(s[0], "0");
+    EXPECT_EQ(s[5], "e");
+    O_EXPECT_THROW(s.Insert(s.begin(), bc), O::Bounded_Vector_Exception);
+}
+
+TEST(Bounded_Vector, Emplace_At_Position)
+{
+    O::Bounded_Vector<int, 4> v(1, 3);
+    EXPECT_EQ(*v.Emplace(v.begin() + 1, 2), 2);
+    v.Emplace(v.end(), 4);
+    EXPECT_TRUE(std::ranges::equal(v, std::array{ 1, 2, 3, 4 }));
+    O_EXPECT_THROW(v.Emplace(v.begin(), 0), O::Bounded_Vector_Exception);
+
+    O::Bounded_Vector<std::string, 4> s(std::string("b"));
+    s.Emplace(s.begin(), s[0]); // argument aliasing a shifted element
+    s.Emplace(s.begin(), 3, 'a');
+    ASSERT_EQ(s.Size(), 3u);
+    EXPECT_EQ(s[0], "aaa");
+    EXPECT_EQ(s[1], "b");
+    EXPECT_EQ(s[2], "b");
+}
+
+TEST(Bounded_Vector, Erase_Range_Trivial_And_Non_Trivial)
+{
+    O::Bounded_Vector<int, 8> v(1, 2, 3, 4, 5);
+    int* next = v.Erase(v.begin() + 1, v.begin() + 3);
+    EXPECT_EQ(*next, 4);
+    EXPECT_TRUE(std::ranges::equal(v, std::array{ 1, 4, 5 }));
+    v.Erase(v.end() - 1);
+    EXPECT_TRUE(std::ranges::equal(v, std::array{ 1, 4 }));
+
+    ResetTrackableCounters();
+    {
+        O::Bounded_Vector<Trackable, 4> t;
+        for (int i = 0; i < 4; ++i)
+            t.Emplace_Back(i);
+        t.Erase(t.begin(), t.begin() + 2);
+        ASSERT_EQ(t.Size(), 2u);
+        EXPECT_EQ(t[0].value, 2);
+        EXPECT_EQ(t[1].value, 3);
+        EXPECT_EQ(Trackable::constructions - Trackable::destructions, 2);
+    }
+    EXPECT_EQ(Trackable::destructions, Trackable::constructions);
+}
+
+#if O_UTILS_HAS_EXCEPTIONS
+// owns heap memory, so that a slot destroyed twice is a double free under ASan
+struct Throwing_Move
+{
+    static int moves_left; // the next move throws once it reaches 0
+    static int alive;
+
+    std::unique_ptr<int> value;
+    explicit Throwing_Move(int v) : value(std::make_unique<int>(v)) { ++alive; }
+    Throwing_Move(Throwing_Move&& o) : value(std::move(Counted(o).value)) { ++alive; }
+    Throwing_Move& operator=(Throwing_Move&& o) { value = std::move(Counted(o).value); return *this; }
+    ~Throwing_Move() { --alive; }
+
+    static Throwing_Move& Counted(Throwing_Move& o)
+    {
+        if (moves_left-- == 0) throw std::runtime_error("move");
+        return o;
+    }
+};
+
+int Throwing_Move::moves_left = std::numeric_limits<int>::max();
+int Throwing_Move::alive = 0;
+
+TEST(Bounded_Vector, Throwing_Move_Leaves_Every_Element_Alive_Once)
+{
+    Throwing_Move::alive = 0;
+    {
+        O::Bounded_Vector<Throwing_Move, 8> v;
+        for (int i = 0; i < 4; ++i)
+            v.Emplace_Back(i);
+
+        Throwing_Move::moves_left = 1;
+        EXPECT_THROW(v.Erase(v.begin()), std::runtime_error);
+        EXPECT_EQ(Throwing_Move::alive, static_cast<int>(v.Size()));
+
+        Throwing_Move::moves_left = 1;
+        EXPECT_THROW(v.Emplace(v.begin(), 9), std::runtime_error);
+        EXPECT_EQ(Throwing_Move::alive, static_cast<int>(v.Size()));
+
+        Throwing_Move::moves_left = 1;
+        EXPECT_THROW(v.Insert(v.begin(), std::array<int, 2>{ 7, 8 }), std::runtime_error);
+        EXPECT_EQ(Throwing_Move::alive, static_cast<int>(v.Size()));
+
+        Throwing_Move::moves_left = std::numeric_limits<int>::max();
+        v.Erase(v.begin(), v.begin() + 2);
+        EXPECT_EQ(Throwing_Move::alive, static_cast<int>(v.Size()));
+    }
+    EXPECT_EQ(Throwing_Move::alive, 0);
+}
+#endif
+
+TEST(Bounded_Vector, Resize)
+{
+    O::Bounded_Vector<std::string, 4> v;
+    v.Resize(2);
+    EXPECT_EQ(v.Size(), 2u);
+    EXPECT_TRUE(v[1].empty());
+    v.Resize(4, "x");
+    EXPECT_EQ(v[3], "x");
+    v.Resize(1);
+    EXPECT_EQ(v.Size(), 1u);
+    O_EXPECT_THROW(v.Resize(5), O::Bounded_Vector_Exception);
+}
+
+TEST(Bounded_Vector, Resize_Uninitialized_Then_Write_Through_Data)
+{
+    O::Bounded_Vector<std::uint8_t, 16> v;
+    const char payload[] = "parsed";
+    v.Resize_Uninitialized(6);
+    std::memcpy(v.Data(), payload, 6);
+    EXPECT_EQ(v.Size(), 6u);
+    EXPECT_EQ(v[5], 'd');
+    O_EXPECT_THROW(v.Resize_Uninitialized(17), O::Bounded_Vector_Exception);
+}
+
+/* ------------------------
+   Over-aligned, SIMD-padded storage
+   ------------------------ */
+using Avx_Floats = O::Bounded_Vector<float, 10, 32>;
+static_assert(Avx_Floats::LANES == 8);
+static_assert(Avx_Floats::CAPACITY == 16);
+static_assert(alignof(Avx_Floats) == 32);
+static_assert(std::is_trivially_copyable_v<Avx_Floats>);
+static_assert(O::Bounded_Vector<float, 10>::CAPACITY == 10);
+static_assert(O::Bounded_Vector<std::array<float, 3>, 5, 32>::LANES == 8);
+static_assert(O::Bounded_Vector<double, 3, 64>::CAPACITY == 8);
+
+TEST(Bounded_Vector, Over_Aligned_Storage_Rounds_Capacity_To_Lanes)
+{
+    struct Holder { char tag; Avx_Floats v; } holder{};
+    Avx_Floats& v = holder.v;
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.Data()) % 32, 0u);
+    EXPECT_EQ(v.Capacity(), 16u);
+    EXPECT_EQ(v.Padded_Size(), 0u);
+
+    for (int i = 1; i <= 10; ++i)
+        v.Push_Back(static_cast<float>(i));
+    EXPECT_FALSE(v.Full());
+    EXPECT_EQ(v.Padded_Size(), 16u);
+
+    // neutral padding lets a kernel sum whole registers
+    v.Fill_Padding(0.0f);
+    float sum = 0.0f;
+    for (std::size_t i = 0; i < v.Padded_Size(); ++i)
+        sum += v.Data()[i];
+    EXPECT_EQ(sum, 55.0f);
+    EXPECT_EQ(v.Size(), 10u);
+
+    v.Resize(8);
+    EXPECT_EQ(v.Padded_Size(), 8u);
+    for (int i = 0; i < 8; ++i)
+        v.Push_Back(0.0f);
+    EXPECT_TRUE(v.Full());
 }
 
 /* ------------------------
@@ -223,27 +521,157 @@ TEST(Bounded_Vector, Exception_Types_Are_Correct)
 {
     O::Bounded_Vector<int, 1> v;
     // Pop on empty
-    try {
-        v.Pop_Back();
-        FAIL() << "Expected pop to throw";
-    } catch (const O::Bounded_Vector_Exception& ex) {
-        EXPECT_EQ(ex, O::Bounded_Vector_Exception::NO_MORE_ELEMENT_TO_POP);
-    }
+    O_EXPECT_THROW_VALUE(v.Pop_Back(), O::Bounded_Vector_Exception::NO_MORE_ELEMENT_TO_POP);
 
     // push to fill and then push again
     v.Push_Back(42);
-    try {
-        v.Push_Back(43);
-        FAIL() << "Expected push to throw";
-    } catch (const O::Bounded_Vector_Exception& ex) {
-        EXPECT_EQ(ex, O::Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
-    }
+    O_EXPECT_THROW_VALUE(v.Push_Back(43), O::Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
 
     // At out-of-range
-    try {
-        v.At(5);
-        FAIL() << "Expected At to throw";
-    } catch (const O::Bounded_Vector_Exception& ex) {
-        EXPECT_EQ(ex, O::Bounded_Vector_Exception::OUT_OF_RANGE);
+    O_EXPECT_THROW_VALUE(v.At(5), O::Bounded_Vector_Exception::OUT_OF_RANGE);
+}
+/* ------------------------
+   Non-throwing Try_* API
+   ------------------------ */
+TEST(Bounded_Vector, Try_API_Reports_Errors_Without_Throwing)
+{
+    O::Bounded_Vector<std::string, 2> v;
+
+    auto popped = v.Try_Pop_Back();
+    ASSERT_TRUE(popped.Has_Error());
+    EXPECT_EQ(popped.Error(), O::Bounded_Vector_Exception::NO_MORE_ELEMENT_TO_POP);
+
+    auto first = v.Try_Emplace_Back(3, 'a');
+    ASSERT_TRUE(first.Has_Value());
+    EXPECT_EQ(*first.Value(), "aaa");
+    EXPECT_EQ(first.Value(), v.Data());
+    ASSERT_TRUE(v.Try_Emplace_Back("b").Has_Value());
+
+    auto full = v.Try_Emplace_Back("c");
+    ASSERT_TRUE(full.Has_Error());
+    EXPECT_EQ(full.Error(), O::Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+    EXPECT_EQ(v.Size(), 2u);
+
+    const auto& cv = v;
+    auto at = cv.Try_At(1);
+    ASSERT_TRUE(at.Has_Value());
+    EXPECT_EQ(*at.Value(), "b");
+    auto out = cv.Try_At(2);
+    ASSERT_TRUE(out.Has_Error());
+    EXPECT_EQ(out.Error(), O::Bounded_Vector_Exception::OUT_OF_RANGE);
+    *v.Try_At(0).Value() = "z";
+    EXPECT_EQ(v[0], "z");
+
+    popped = v.Try_Pop_Back();
+    ASSERT_TRUE(popped.Has_Value());
+    EXPECT_EQ(popped.Value(), "b");
+    EXPECT_EQ(v.Size(), 1u);
+}
+
+TEST(Bounded_Vector, Try_API_Destroys_Popped_Element_Once)
+{
+    ResetTrackableCounters();
+    {
+        O::Bounded_Vector<Trackable, 2> v;
+        ASSERT_TRUE(v.Try_Emplace_Back(7).Has_Value());
+        auto popped = v.Try_Pop_Back();
+        ASSERT_TRUE(popped.Has_Value());
+        EXPECT_EQ(popped.Value().value, 7);
+        EXPECT_TRUE(v.Empty());
+        EXPECT_EQ(Trackable::constructions - Trackable::destructions, 1);
+    }
+    EXPECT_EQ(Trackable::constructions, Trackable::destructions);
+}
+
+#if O_UTILS_HAS_EXCEPTIONS
+TEST(Bounded_Vector, Try_Pop_Back_Keeps_The_Element_When_Its_Move_Throws)
+{
+    Throwing_Move::alive = 0;
+    {
+        O::Bounded_Vector<Throwing_Move, 2> v;
+        v.Emplace_Back(3);
+        Throwing_Move::moves_left = 0;
+        EXPECT_THROW(v.Try_Pop_Back(), std::runtime_error);
+        Throwing_Move::moves_left = std::numeric_limits<int>::max();
+        ASSERT_EQ(v.Size(), 1u);
+        EXPECT_EQ(*v[0].value, 3);
+        EXPECT_EQ(Throwing_Move::alive, 1);
     }
-}
\ No newline at end of file
+    EXPECT_EQ(Throwing_Move::alive, 0);
+}
+#endif
+
+/* ------------------------
+   Constant evaluation
+   ------------------------ */
+struct Ellipsoid { double a; double inv_f; int code; };
+
+static constexpr O::Bounded_Vector<Ellipsoid, 4> Make_Ellipsoids()
+{
+    O::Bounded_Vector<Ellipsoid, 4> table;
+    table.Push_Back({ 6378137.0, 298.257223563, 7030 });
+    table.Push_Back({ 6378388.0, 297.0, 7022 });
+    table.Emplace_Back(6378249.2, 293.4660213, 7011);
+    table.Erase(table.begin() + 1);
+    return table;
+}
+
+// built by the compiler, not at startup
+static constexpr auto ELLIPSOIDS = Make_Ellipsoids();
+static_assert(ELLIPSOIDS.Size() == 2);
+static_assert(ELLIPSOIDS[1].code == 7011);
+static_assert(ELLIPSOIDS.At(0).a == 6378137.0);
+
+static constexpr int Edit_In_Constant_Evaluation()
+{
+    O::Bounded_Vector<int, 10> v(1, 2, 3);
+    const std::array<int, 3> more = { 7, 8, 9 };
+    v.Append(more);                                 // 1 2 3 7 8 9
+    v.Insert(v.begin() + 1, more);                  // 1 7 8 9 2 3 7 8 9
+    v.Emplace(v.begin(), 0);                        // 0 1 7 8 9 2 3 7 8 9
+    v.Erase(v.begin() + 2, v.begin() + 4);          // 0 1 9 2 3 7 8 9
+    v.Resize(9, 5);                                 // 0 1 9 2 3 7 8 9 5
+    const int popped = v.Try_Pop_Back().Value();    // 5
+    const auto copy = v;
+    return std::accumulate(copy.begin(), copy.end(), 0) * 10 + popped;
+}
+static_assert(Edit_In_Constant_Evaluation() == 395);
+
+// non-trivial elements work in constant evaluation too, as long as they do not outlive it
+static constexpr std::size_t Strings_In_Constant_Evaluation()
+{
+    O::Bounded_Vector<std::string, 4> v;
+    v.Emplace_Back("alpha");
+    v.Emplace_Back("be");
+    v.Emplace(v.begin(), "x");
+    v.Erase(v.begin() + 1);
+    O::Bounded_Vector<std::string, 4> moved = std::move(v);
+    O::Bounded_Vector<std::string, 4> copy;
+    copy = moved;
+    return copy[0].size() * 10 + copy[1].size() + v.Size();
+}
+static_assert(Strings_In_Constant_Evaluation() == 12);
+
+#if O_UTILS_CONSTEXPR_NICHE
+// Try_At() and Try_Emplace_Back() return niche-packed pointers
+static constexpr int Try_In_Constant_Evaluation()
+{
+    O::Bounded_Vector<int, 2> v;
+    *v.Try_Emplace_Back(4).Value() += 1;
+    v.Try_Emplace_Back(6);
+    const bool full = v.Try_Emplace_Back(7).Error() == O::Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE;
+    const bool out = v.Try_At(2).Error() == O::Bounded_Vector_Exception::OUT_OF_RANGE;
+    return *v.Try_At(0).Value() * 10 + *v.Try_At(1).Value() + (full && out ? 100 : 0);
+}
+static_assert(Try_In_Constant_Evaluation() == 156);
+static_assert(ELLIPSOIDS.Try_At(1).Value()->code == 7011);
+#endif
+
+TEST(Bounded_Vector, Constexpr_Members_Give_The_Same_Results_At_Run_Time)
+{
+    const auto table = Make_Ellipsoids();
+    ASSERT_EQ(table.Size(), ELLIPSOIDS.Size());
+    EXPECT_EQ(table[1].code, ELLIPSOIDS[1].code);
+    EXPECT_EQ(Edit_In_Constant_Evaluation(), 395);
+    EXPECT_EQ(Strings_In_Constant_Evaluation(), 12u);
+}
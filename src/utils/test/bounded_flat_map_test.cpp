@@ -0,0 +1,143 @@
+// bounded_flat_map_test.cpp
+#include <gtest/gtest.h>
+
+#include "utils/bounded_flat_map.h"
+#include "utils/zip.h"
+#include "exception_utils_test.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+/* ------------------------
+   Search strategies
+   ------------------------ */
+template<std::size_t N, typename K>
+static void Check_Lower_Bound_Against_Std(const std::vector<K>& keys)
+{
+	for (K probe = keys.front() - 2; probe <= keys.back() + 2; ++probe)
+	{
+		const auto expected = static_cast<std::size_t>(std::lower_bound(keys.begin(), keys.end(), probe) - keys.begin());
+		EXPECT_EQ(O::Flat_Lower_Bound<N>(keys.data(), keys.size(), probe, std::less<K>{}), expected) << "probe " << probe;
+	}
+}
+
+TEST(Bounded_Flat_Map, Linear_And_Binary_Search_Match_Std_Lower_Bound)
+{
+	std::vector<int> keys{ 1, 3, 4, 8, 10, 11, 20, 21, 22, 40 };
+	Check_Lower_Bound_Against_Std<16>(keys);   // linear compare
+	Check_Lower_Bound_Against_Std<1024>(keys); // branchless binary search
+	Check_Lower_Bound_Against_Std<1024>(std::vector<int>{ 5 });
+	EXPECT_EQ(O::Flat_Lower_Bound<1024>(keys.data(), 0, 3, std::less<int>{}), 0u);
+}
+
+/* ------------------------
+   Map
+   ------------------------ */
+TEST(Bounded_Flat_Map, Insert_Keeps_Keys_Sorted)
+{
+	O::Bounded_Flat_Map<int, std::string, 8> map;
+	EXPECT_TRUE(map.Insert(5, "five"));
+	EXPECT_TRUE(map.Insert(1, "one"));
+	EXPECT_TRUE(map.Insert(3, "three"));
+	EXPECT_FALSE(map.Insert(3, "other"));
+
+	EXPECT_EQ(map.Size(), 3u);
+	EXPECT_TRUE(std::ranges::equal(map.Keys(), std::vector<int>{ 1, 3, 5 }));
+	EXPECT_EQ(map.Values()[1], "three");
+}
+
+TEST(Bounded_Flat_Map, Find_Returns_Expected)
+{
+	O::Bounded_Flat_Map<int, double, 4> map;
+	map.Insert(2, 2.5);
+	map.Insert(7, 7.5);
+
+	auto found = map.Find(7);
+	ASSERT_TRUE(found.Has_Value());
+	EXPECT_EQ(*found.Value(), 7.5);
+	*found.Value() = 1.0;
+	EXPECT_EQ(*map.Find(7).Value(), 1.0);
+
+	auto missing = map.Find(3);
+	ASSERT_TRUE(missing.Has_Error());
+	EXPECT_EQ(missing.Error(), O::Bounded_Vector_Exception::KEY_NOT_FOUND);
+
+	const auto& const_map = map;
+	EXPECT_TRUE(const_map.Find(2).Has_Value());
+	EXPECT_TRUE(const_map.Contains(2));
+	EXPECT_FALSE(const_map.Contains(8));
+}
+
+TEST(Bounded_Flat_Map, Insert_Or_Assign_Erase_And_Full)
+{
+	O::Bounded_Flat_Map<std::string, int, 2> map;
+	map.Insert("b", 2);
+	EXPECT_FALSE(map.Insert_Or_Assign("b", 20));
+	EXPECT_TRUE(map.Insert_Or_Assign("a", 1));
+	EXPECT_EQ(*map.Find("b").Value(), 20);
+	EXPECT_TRUE(map.Full());
+	O_EXPECT_THROW(map.Insert("c", 3), O::Bounded_Vector_Exception);
+
+	EXPECT_TRUE(map.Erase("a"));
+	EXPECT_FALSE(map.Erase("a"));
+	EXPECT_EQ(map.Size(), 1u);
+	EXPECT_EQ(map.Keys()[0], "b");
+	map.Clear();
+	EXPECT_TRUE(map.Empty());
+}
+
+TEST(Bounded_Flat_Map, Move_Only_Values)
+{
+	O::Bounded_Flat_Map<int, std::unique_ptr<int>, 4> map;
+	map.Insert(2, std::make_unique<int>(20));
+	map.Insert(1, std::make_unique<int>(10));
+	EXPECT_EQ(**map.Find(1).Value(), 10);
+	EXPECT_EQ(**map.Find(2).Value(), 20);
+}
+
+TEST(Bounded_Flat_Map, Large_Capacity_Uses_Binary_Search)
+{
+	O::Bounded_Flat_Map<int, int, 256> map;
+	for (int i = 200; i > 0; --i)
+		map.Insert(i * 2, i);
+	EXPECT_EQ(*map.Find(100).Value(), 50);
+	EXPECT_FALSE(map.Contains(101));
+	EXPECT_TRUE(std::ranges::is_sorted(map.Keys()));
+}
+
+TEST(Bounded_Flat_Map, Zip_Keys_And_Values)
+{
+	O::Bounded_Flat_Map<int, int, 8> map;
+	map.Insert(3, 30);
+	map.Insert(1, 10);
+	auto keys = map.Keys();
+	auto values = map.Values();
+	for (auto&& [key, value] : O::Zip(keys, values))
+		EXPECT_EQ(key * 10, value);
+}
+
+/* ------------------------
+   Set
+   ------------------------ */
+TEST(Bounded_Flat_Set, Insert_Find_Erase)
+{
+	O::Bounded_Flat_Set<int, 4> set;
+	EXPECT_TRUE(set.Insert(4));
+	EXPECT_TRUE(set.Insert(2));
+	EXPECT_FALSE(set.Insert(4));
+	EXPECT_TRUE(std::ranges::equal(set, std::vector<int>{ 2, 4 }));
+
+	EXPECT_EQ(*set.Find(2).Value(), 2);
+	EXPECT_EQ(set.Find(3).Error(), O::Bounded_Vector_Exception::KEY_NOT_FOUND);
+	EXPECT_TRUE(set.Erase(2));
+	EXPECT_FALSE(set.Contains(2));
+
+	set.Insert(1);
+	set.Insert(3);
+	set.Insert(5);
+	EXPECT_TRUE(set.Full());
+	O_EXPECT_THROW(set.Insert(6), O::Bounded_Vector_Exception);
+}
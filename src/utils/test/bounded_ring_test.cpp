@@ -0,0 +1,148 @@
+// bounded_ring_test.cpp
+#include <gtest/gtest.h>
+
+#include "utils/bounded_ring.h"
+#include "utils/zip.h"
+
+#include <string>
+#include <vector>
+
+#include "expected_utils_test.h"
+#include "exception_utils_test.h"
+
+
+static_assert(std::is_trivially_copyable_v<O::Bounded_Ring<int, 8>>);
+static_assert(!std::is_trivially_copyable_v<O::Bounded_Ring<std::string, 8>>);
+static_assert(sizeof(O::Bounded_Ring<std::uint8_t, 16>) == 18);
+
+// Helper collecting the ring through its two spans
+template<typename Ring>
+static std::vector<int> Collect_Spans(const Ring& ring)
+{
+	std::vector<int> out;
+	for (int v : ring.First_Span()) out.push_back(v);
+	for (int v : ring.Second_Span()) out.push_back(v);
+	return out;
+}
+
+/* ------------------------
+   Push / pop at both ends
+   ------------------------ */
+TEST(Bounded_Ring, Default_Constructed_Empty)
+{
+	O::Bounded_Ring<int, 4> r;
+	EXPECT_EQ(r.Capacity(), 4u);
+	EXPECT_EQ(r.Size(), 0u);
+	EXPECT_TRUE(r.Empty());
+	EXPECT_FALSE(r.Full());
+	EXPECT_TRUE(r.First_Span().empty());
+	EXPECT_TRUE(r.Second_Span().empty());
+}
+
+TEST(Bounded_Ring, Push_Pop_Both_Ends)
+{
+	O::Bounded_Ring<int, 4> r;
+	r.Push_Back(2);
+	r.Push_Back(3);
+	r.Push_Front(1);
+	r.Push_Front(0);
+	EXPECT_TRUE(r.Full());
+	EXPECT_EQ(r.Front(), 0);
+	EXPECT_EQ(r.Back(), 3);
+	for (std::size_t i = 0; i < r.Size(); ++i)
+		EXPECT_EQ(r[i], static_cast<int>(i));
+
+	r.Pop_Front();
+	r.Pop_Back();
+	EXPECT_EQ(r.Size(), 2u);
+	EXPECT_EQ(r.Front(), 1);
+	EXPECT_EQ(r.Back(), 2);
+}
+
+TEST(Bounded_Ring, Sliding_Window_Wraps)
+{
+	O::Bounded_Ring<int, 4> r;
+	for (int i = 0; i < 10; ++i)
+	{
+		if (r.Full())
+			r.Pop_Front();
+		r.Push_Back(i);
+	}
+	EXPECT_EQ(Collect_Spans(r), (std::vector<int>{ 6, 7, 8, 9 }));
+	EXPECT_EQ(r.First_Span().size() + r.Second_Span().size(), 4u);
+}
+
+TEST(Bounded_Ring, Exceptions)
+{
+	O::Bounded_Ring<int, 2> r;
+	O_EXPECT_THROW(r.Pop_Back(), O::Bounded_Vector_Exception);
+	O_EXPECT_THROW(r.Pop_Front(), O::Bounded_Vector_Exception);
+	r.Push_Back(1);
+	r.Push_Front(0);
+	O_EXPECT_THROW_VALUE(r.Push_Back(2), O::Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+	O_EXPECT_THROW(r.Push_Front(2), O::Bounded_Vector_Exception);
+	O_EXPECT_THROW(r.At(2), O::Bounded_Vector_Exception);
+	EXPECT_EQ(r.At(1), 1);
+}
+
+/* ------------------------
+   Span interop
+   ------------------------ */
+TEST(Bounded_Ring, Spans_Feed_Zip_And_For_Each_Indexed)
+{
+	O::Bounded_Ring<int, 4> r;
+	r.Push_Back(1);
+	r.Push_Back(2);
+	r.Push_Front(0);
+	ASSERT_FALSE(r.Second_Span().empty());
+
+	auto first = r.First_Span();
+	std::vector<int> weights(first.size(), 10);
+	int sum = 0;
+	for (auto&& [value, weight] : O::Zip(first, weights))
+		sum += value * weight;
+	EXPECT_EQ(sum, 0);
+
+	auto second = r.Second_Span();
+	O::For_Each_Indexed(second, [](int& v, std::size_t i) { v += static_cast<int>(i) * 100; });
+	EXPECT_EQ(r[1], 1);
+	EXPECT_EQ(r[2], 102);
+}
+
+/* ------------------------
+   Copy and move semantics
+   ------------------------ */
+TEST(Bounded_Ring, Copy_And_Move_Non_Trivial)
+{
+	O::Bounded_Ring<std::string, 4> a;
+	a.Push_Back("b");
+	a.Push_Back("c");
+	a.Push_Front("a");
+
+	O::Bounded_Ring<std::string, 4> b(a);
+	ASSERT_EQ(b.Size(), 3u);
+	EXPECT_EQ(b[0], "a");
+	EXPECT_EQ(b[2], "c");
+
+	O::Bounded_Ring<std::string, 4> c;
+	c = std::move(a);
+	EXPECT_EQ(c[1], "b");
+	EXPECT_TRUE(a.Empty());
+}
+
+TEST(Bounded_Ring, Every_Construction_Is_Destroyed)
+{
+	TrackValue::Reset();
+	{
+		O::Bounded_Ring<TrackValue, 4> r;
+		for (int i = 0; i < 9; ++i)
+		{
+			if (r.Full())
+				r.Pop_Front();
+			r.Emplace_Back(i);
+		}
+		O::Bounded_Ring<TrackValue, 4> copy(r);
+		EXPECT_EQ(copy.Back().v, 8);
+	}
+	EXPECT_EQ(TrackValue::constructions + TrackValue::copies + TrackValue::moves, TrackValue::destructions);
+}
@@ -0,0 +1,128 @@
+// bounded_soa_test.cpp
+#include <gtest/gtest.h>
+
+#include "utils/bounded_soa.h"
+#include "utils/zip.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <string>
+
+#include "expected_utils_test.h"
+#include "exception_utils_test.h"
+
+
+using Coordinates = O::Bounded_SoA<16, double, double, double, std::int64_t>;
+
+static_assert(std::ranges::random_access_range<Coordinates>);
+static_assert(std::ranges::random_access_range<const Coordinates>);
+static_assert(std::is_trivially_copyable_v<Coordinates>);
+static_assert(!std::is_trivially_copyable_v<O::Bounded_SoA<4, int, std::string>>);
+
+static Coordinates Make_Coordinates()
+{
+	Coordinates c;
+	for (int i = 0; i < 4; ++i)
+		c.Push_Back(i, 10.0 * i, 100.0 * i, 1000 + i);
+	return c;
+}
+
+/* ------------------------
+   Rows and columns
+   ------------------------ */
+TEST(Bounded_SoA, Push_And_Row_Access)
+{
+	Coordinates c = Make_Coordinates();
+	EXPECT_EQ(c.Size(), 4u);
+	EXPECT_EQ(c.Capacity(), 16u);
+
+	auto [x, y, z, t] = c[2];
+	EXPECT_EQ(x, 2.0);
+	EXPECT_EQ(y, 20.0);
+	EXPECT_EQ(z, 200.0);
+	EXPECT_EQ(t, 1002);
+
+	// references into the columns
+	std::get<1>(c[3]) = -1.0;
+	EXPECT_EQ(c.Column<1>()[3], -1.0);
+	O_EXPECT_THROW(c.At(4), O::Bounded_Vector_Exception);
+}
+
+TEST(Bounded_SoA, Columns_Are_Contiguous_Spans)
+{
+	Coordinates c = Make_Coordinates();
+	auto x = c.Column<0>();
+	auto z = c.Column<2>();
+	EXPECT_EQ(x.size(), 4u);
+	EXPECT_EQ(&x[1], &x[0] + 1);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(c.Column<3>().data()) % O::SIMD_BYTES, 0u);
+	O::Bounded_SoA<3, char, double> narrow;
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(narrow.Column<0>().data()) % O::SIMD_BYTES, 0u);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(narrow.Column<1>().data()) % O::SIMD_BYTES, 0u);
+	EXPECT_EQ(std::accumulate(z.begin(), z.end(), 0.0), 600.0);
+
+	// per-field kernel through the contiguous For_Each_Zip path
+	O::For_Each_Zip(x, z, [](double& a, double& b) { a += b; });
+	EXPECT_EQ(std::get<0>(c[3]), 303.0);
+}
+
+/* ------------------------
+   Zip-native iteration
+   ------------------------ */
+TEST(Bounded_SoA, Range_For_Yields_Tuple_Of_References)
+{
+	Coordinates c = Make_Coordinates();
+	for (auto&& [x, y, z, t] : c)
+		x = y + z + static_cast<double>(t);
+	EXPECT_EQ(c.Column<0>()[1], 10.0 + 100.0 + 1001.0);
+}
+
+TEST(Bounded_SoA, Zip_Index_And_Zip)
+{
+	Coordinates c = Make_Coordinates();
+	for (auto&& [row, index] : O::Zip_Index(c))
+		EXPECT_EQ(std::get<3>(row), 1000 + static_cast<std::int64_t>(index));
+
+	auto x = c.Column<0>();
+	auto y = c.Column<1>();
+	for (auto&& [a, b] : O::Zip(x, y))
+		b -= a * 10.0;
+	EXPECT_TRUE(std::ranges::all_of(c.Column<1>(), [](double v) { return v == 0.0; }));
+}
+
+TEST(Bounded_SoA, Works_With_Std_Algorithms)
+{
+	Coordinates c = Make_Coordinates();
+	auto it = std::ranges::find_if(c, [](const auto& row) { return std::get<3>(row) == 1002; });
+	EXPECT_EQ(it - c.begin(), 2);
+	EXPECT_EQ(std::ranges::distance(c), 4);
+}
+
+/* ------------------------
+   Non trivial fields
+   ------------------------ */
+TEST(Bounded_SoA, Copy_Move_And_Destruction)
+{
+	TrackValue::Reset();
+	{
+		O::Bounded_SoA<4, TrackValue, std::string> a;
+		a.Emplace_Back(1, "one");
+		a.Emplace_Back(2, "two");
+
+		O::Bounded_SoA<4, TrackValue, std::string> b(a);
+		EXPECT_EQ(std::get<1>(b[1]), "two");
+
+		O::Bounded_SoA<4, TrackValue, std::string> c;
+		c = std::move(b);
+		EXPECT_TRUE(b.Empty());
+		EXPECT_EQ(std::get<0>(c[0]).v, 1);
+
+		c.Pop_Back();
+		EXPECT_EQ(c.Size(), 1u);
+		a.Emplace_Back(3, "three");
+		a.Emplace_Back(4, "four");
+		O_EXPECT_THROW(a.Emplace_Back(5, "five"), O::Bounded_Vector_Exception);
+	}
+	EXPECT_EQ(TrackValue::constructions + TrackValue::copies + TrackValue::moves, TrackValue::destructions);
+}
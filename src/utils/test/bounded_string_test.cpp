@@ -0,0 +1,118 @@
+// bounded_string_test.cpp
+#include <gtest/gtest.h>
+
+#include "utils/bounded_string.h"
+#include "utils/bounded_flat_map.h"
+#include "exception_utils_test.h"
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+
+static_assert(std::is_trivially_copyable_v<O::Bounded_String<32>>);
+static_assert(sizeof(O::Bounded_String<31>) == 32);
+
+/* ------------------------
+   Construction / access
+   ------------------------ */
+TEST(Bounded_String, Construct_From_Literal_And_View)
+{
+	O::Bounded_String<16> empty;
+	EXPECT_TRUE(empty.Empty());
+	EXPECT_EQ(empty.Capacity(), 16u);
+
+	O::Bounded_String<16> key = "line_id";
+	EXPECT_EQ(key.Size(), 7u);
+	EXPECT_EQ(key.View(), "line_id");
+	EXPECT_EQ(key[0], 'l');
+
+	std::string_view view = key;
+	EXPECT_EQ(view, "line_id");
+	EXPECT_EQ(std::string(key.begin(), key.end()), "line_id");
+}
+
+TEST(Bounded_String, Too_Long_Throws)
+{
+	O_EXPECT_THROW(O::Bounded_String<4>("abcde"), O::Bounded_Vector_Exception);
+	O::Bounded_String<4> s = "abcd";
+	EXPECT_TRUE(s.Full());
+	O_EXPECT_THROW_VALUE(s.Push_Back('e'), O::Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+}
+
+/* ------------------------
+   Modifiers
+   ------------------------ */
+TEST(Bounded_String, Append)
+{
+	O::Bounded_String<16> s = "geo";
+	s += "json";
+	s += '!';
+	EXPECT_EQ(s, "geojson!");
+	O_EXPECT_THROW(s.Append("0123456789"), O::Bounded_Vector_Exception);
+	EXPECT_EQ(s, "geojson!");
+	s.Clear();
+	EXPECT_TRUE(s.Empty());
+}
+
+/* ------------------------
+   Comparison / hashing
+   ------------------------ */
+TEST(Bounded_String, Compare_Across_Capacities)
+{
+	O::Bounded_String<8> a = "abc";
+	O::Bounded_String<32> b = "abd";
+	EXPECT_TRUE(a < b);
+	EXPECT_TRUE(a != b);
+	EXPECT_TRUE(a == O::Bounded_String<4>("abc"));
+	EXPECT_TRUE(a == std::string_view("abc"));
+	EXPECT_TRUE(a < std::string_view("b"));
+}
+
+TEST(Bounded_String, Hash_Matches_String_View)
+{
+	O::Bounded_String<32> s = "name";
+	EXPECT_EQ(std::hash<O::Bounded_String<32>>{}(s), std::hash<std::string_view>{}("name"));
+
+	std::unordered_map<O::Bounded_String<32>, int> counts;
+	counts["name"] += 1;
+	counts["name"] += 1;
+	counts["id"] += 1;
+	EXPECT_EQ(counts.size(), 2u);
+	EXPECT_EQ(counts["name"], 2);
+}
+
+TEST(Bounded_String, Flat_Map_Key)
+{
+	O::Bounded_Flat_Map<O::Bounded_String<32>, int, 8> properties;
+	properties.Insert("width", 2);
+	properties.Insert("color", 1);
+	EXPECT_EQ(properties.Keys()[0], "color");
+	EXPECT_EQ(*properties.Find("width").Value(), 2);
+	EXPECT_FALSE(properties.Contains("height"));
+
+	O::Bounded_Flat_Set<O::Bounded_String<16>, 4> tags;
+	tags.Insert("b");
+	tags.Insert("a");
+	EXPECT_TRUE(tags.Contains("a"));
+}
+
+// lookups compare the text as is: a key longer than the capacity is simply not found, no Bounded_String is built
+TEST(Bounded_String, Flat_Map_Lookup_Does_Not_Convert)
+{
+	O::Bounded_Flat_Map<O::Bounded_String<8>, int, 4> properties;
+	properties.Insert("width", 2);
+	const std::string long_key = "a_property_name_longer_than_eight";
+	static_assert(noexcept(properties.Find(std::string_view(long_key))));
+
+	EXPECT_EQ(properties.Find(std::string_view(long_key)).Error(), O::Bounded_Vector_Exception::KEY_NOT_FOUND);
+	EXPECT_EQ(properties.Find("a_property_name_longer_than_eight").Error(), O::Bounded_Vector_Exception::KEY_NOT_FOUND);
+	EXPECT_FALSE(properties.Contains(long_key));
+	EXPECT_EQ(*std::as_const(properties).Find(std::string_view("width")).Value(), 2);
+
+	O::Bounded_Flat_Set<O::Bounded_String<4>, 4> tags;
+	tags.Insert("abc");
+	EXPECT_TRUE(tags.Contains(std::string_view("abc")));
+	EXPECT_EQ(tags.Find(std::string_view("abcdef")).Error(), O::Bounded_Vector_Exception::KEY_NOT_FOUND);
+}
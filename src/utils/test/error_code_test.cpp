@@ -0,0 +1,119 @@
+// error_code_test.cpp
+#include <gtest/gtest.h>
+
+#include "utils/error_code.h"
+#include "utils/expected.h"
+
+#include <string>
+
+
+enum class Parse_Error : std::int32_t { EMPTY = 1, NOT_A_NUMBER, OVERFLOW };
+
+template<>
+struct O::Error_Code_Enum<Parse_Error>
+{
+	static constexpr bool ENABLED = true;
+	static constexpr std::uint32_t CATEGORY = 200;
+};
+
+static int message_lookups = 0;
+
+static constexpr O::Error_Category PARSE_CATEGORY = { "parse", [](std::int32_t code) noexcept -> const char* {
+	++message_lookups;
+	switch (static_cast<Parse_Error>(code))
+	{
+	case Parse_Error::EMPTY: return "empty field";
+	case Parse_Error::NOT_A_NUMBER: return "not a number";
+	default: return nullptr;
+	}
+} };
+
+static O::Expected<int, O::Error_Code> Parse_Int(const std::string& field)
+{
+	if (field.empty()) return Parse_Error::EMPTY;
+	int value = 0;
+	for (char c : field)
+	{
+		if (c < '0' || c > '9') return Parse_Error::NOT_A_NUMBER;
+		value = value * 10 + (c - '0');
+	}
+	return value;
+}
+
+static_assert(sizeof(O::Error_Code) == 8);
+static_assert(std::is_trivially_copyable_v<O::Error_Code>);
+static_assert(sizeof(O::Expected<int, O::Error_Code>) == 8);
+static_assert(sizeof(O::Expected<void, O::Error_Code>) == 8);
+static_assert(std::is_trivially_copyable_v<O::Expected<int, O::Error_Code>>);
+static_assert(O::Error_Code(Parse_Error::EMPTY) == O::Error_Code(200, 1));
+static_assert(O::Error_Code(Parse_Error::EMPTY).Is(Parse_Error::EMPTY));
+
+TEST(Error_Code, Enum_Converts_Into_Expected)
+{
+	auto ok = Parse_Int("42");
+	ASSERT_TRUE(ok.Has_Value());
+	EXPECT_EQ(ok.Value(), 42);
+
+	auto bad = Parse_Int("4x");
+	ASSERT_TRUE(bad.Has_Error());
+	EXPECT_EQ(bad.Error().Category(), 200u);
+	EXPECT_EQ(bad.Error().Code(), 2);
+	EXPECT_TRUE(bad.Error().Is(Parse_Error::NOT_A_NUMBER));
+	EXPECT_FALSE(bad.Error().Is(Parse_Error::EMPTY));
+	EXPECT_EQ(bad.Error(), Parse_Error::NOT_A_NUMBER);
+
+	EXPECT_TRUE(Parse_Int("").Error().Is(Parse_Error::EMPTY));
+}
+
+TEST(Error_Code, Messages_Are_Resolved_Only_When_Formatted)
+{
+	ASSERT_TRUE(O::Error_Registry::Register(200, PARSE_CATEGORY));
+	EXPECT_TRUE(O::Error_Registry::Register(200, PARSE_CATEGORY));
+	EXPECT_EQ(O::Error_Registry::Find(200), &PARSE_CATEGORY);
+
+	message_lookups = 0;
+	for (int i = 0; i < 100; ++i)
+		static_cast<void>(Parse_Int("x"));
+	EXPECT_EQ(message_lookups, 0);
+
+	const O::Error_Code error = Parse_Int("x").Error();
+	EXPECT_STREQ(error.Category_Name(), "parse");
+	EXPECT_STREQ(error.Message(), "not a number");
+	EXPECT_EQ(error.To_String(), "parse: not a number (2)");
+	EXPECT_EQ(message_lookups, 2);
+
+	EXPECT_STREQ(O::Error_Code(Parse_Error::OVERFLOW).Message(), "unknown error");
+}
+
+TEST(Error_Code, Unregistered_And_Invalid_Categories)
+{
+	const O::Error_Code unknown(201, 7);
+	EXPECT_STREQ(unknown.Category_Name(), "unknown category");
+	EXPECT_EQ(unknown.To_String(), "unknown category: unknown error (7)");
+	EXPECT_EQ(O::Error_Code(), O::Error_Code(0, 0));
+
+	static constexpr O::Error_Category OTHER = { "other", nullptr };
+	EXPECT_FALSE(O::Error_Registry::Register(0, OTHER));
+	EXPECT_FALSE(O::Error_Registry::Register(O::Error_Registry::CAPACITY, OTHER));
+	ASSERT_TRUE(O::Error_Registry::Register(200, PARSE_CATEGORY));
+	EXPECT_FALSE(O::Error_Registry::Register(200, OTHER));
+	ASSERT_TRUE(O::Error_Registry::Register(202, OTHER));
+	EXPECT_STREQ(O::Error_Code(202, 1).Message(), "unknown error");
+	EXPECT_EQ(O::Error_Registry::Find(O::Error_Registry::CAPACITY + 5), nullptr);
+}
+
+TEST(Error_Code, Out_Of_Range_Category_Stays_An_Error)
+{
+	// the id's high-order byte is the niche of Expected<T, Error_Code>: a bad id must not turn the error into a value
+#ifdef NDEBUG
+	const O::Error_Code clamped(0xFF000001u, 5);
+	EXPECT_EQ(clamped.Category(), 0u);
+	EXPECT_EQ(clamped.Code(), 5);
+	const O::Expected<int, O::Error_Code> e(clamped);
+	EXPECT_TRUE(e.Has_Error());
+	EXPECT_FALSE(e.Has_Value());
+#else
+	GTEST_FLAG_SET(death_test_style, "threadsafe");
+	EXPECT_DEATH(static_cast<void>(O::Error_Code(0xFF000001u, 5)), "out of range");
+#endif
+}
@@ -0,0 +1,25 @@
+#ifndef SRC_UTILS_EXCEPTION_TEST_H
+#define SRC_UTILS_EXCEPTION_TEST_H
+
+#include <gtest/gtest.h>
+
+#include "utils/exceptions.h"
+
+// Throw expectations that still compile with exceptions disabled: a throwing path then terminates, so it is checked as a death test.
+#if O_UTILS_HAS_EXCEPTIONS
+	#define O_EXPECT_THROW(statement, exception_type) EXPECT_THROW(statement, exception_type)
+	#define O_EXPECT_NO_THROW(statement) EXPECT_NO_THROW(statement)
+	#define O_EXPECT_THROW_VALUE(statement, value) \
+		try { \
+			statement; \
+			ADD_FAILURE() << "Expected " #statement " to throw"; \
+		} catch (const decltype(value)& ex) { \
+			EXPECT_EQ(ex, value); \
+		}
+#else
+	#define O_EXPECT_THROW(statement, exception_type) EXPECT_DEATH(statement, "unrecoverable error")
+	#define O_EXPECT_NO_THROW(statement) statement
+	#define O_EXPECT_THROW_VALUE(statement, value) EXPECT_DEATH(statement, "unrecoverable error")
+#endif
+
+#endif // SRC_UTILS_EXCEPTION_TEST_H
@@ -0,0 +1,125 @@
+// expected_collect_test.cpp
+#include <gtest/gtest.h>
+
+#include "utils/expected_collect.h"
+#include "utils/small_vector.h"
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "expected_utils_test.h"
+#include "exception_utils_test.h"
+
+
+enum class Parse_Error : unsigned char { NEGATIVE = 1, TOO_LARGE };
+
+using Parsed = O::Expected<int, Parse_Error>;
+
+static Parsed Parse(int x)
+{
+	if (x < 0) return Parse_Error::NEGATIVE;
+	if (x > 100) return Parse_Error::TOO_LARGE;
+	return x;
+}
+
+TEST(Expected_Collect, Collects_Values_In_Order)
+{
+	const std::vector<Parsed> inputs = { Parse(1), Parse(2), Parse(3) };
+
+	auto values = O::Collect(inputs);
+	static_assert(std::is_same_v<decltype(values), O::Expected<std::vector<int>, Parse_Error>>);
+	ASSERT_TRUE(values.Has_Value());
+	EXPECT_EQ(values.Value(), (std::vector<int>{ 1, 2, 3 }));
+	EXPECT_EQ(values.Value().capacity(), 3u);
+
+	auto bounded = O::Collect<O::Bounded_Vector<int, 4>>(inputs);
+	ASSERT_TRUE(bounded.Has_Value());
+	ASSERT_EQ(bounded.Value().Size(), 3u);
+	EXPECT_EQ(bounded.Value()[2], 3);
+
+	auto small = O::Collect<O::Small_Vector<int, 2>>(inputs);
+	ASSERT_TRUE(small.Has_Value());
+	EXPECT_EQ(small.Value().Size(), 3u);
+
+	EXPECT_TRUE(O::Collect(std::vector<Parsed>{}).Value().empty());
+}
+
+TEST(Expected_Collect, Stops_At_The_First_Error)
+{
+	int parsed = 0;
+	const std::vector<int> raw = { 1, -1, 200, 4 };
+	auto lazy = raw | std::views::transform([&](int x) { ++parsed; return Parse(x); });
+
+	auto values = O::Collect<O::Bounded_Vector<int, 4>>(lazy);
+	ASSERT_TRUE(values.Has_Error());
+	EXPECT_EQ(values.Error(), Parse_Error::NEGATIVE);
+	EXPECT_EQ(parsed, 2);
+
+	const std::vector<Parsed> with_empty = { Parse(1), Parsed() };
+	auto empty = O::Collect(with_empty);
+	EXPECT_FALSE(empty.Has_Value());
+	EXPECT_FALSE(empty.Has_Error());
+}
+
+TEST(Expected_Collect, Moves_Out_Of_Rvalue_Ranges)
+{
+	using Tracked = O::Expected<TrackValue, TrackError>;
+	TrackValue::Reset();
+	TrackError::Reset();
+	{
+		std::vector<Tracked> inputs;
+		for (int i = 0; i < 4; ++i)
+			inputs.push_back(Tracked::Make_Value(i));
+
+		int copies = TrackValue::copies, moves = TrackValue::moves;
+		auto copied = O::Collect(inputs);
+		ASSERT_TRUE(copied.Has_Value());
+		EXPECT_EQ(TrackValue::copies - copies, 4);
+		EXPECT_EQ(TrackValue::moves - moves, 0);
+
+		copies = TrackValue::copies, moves = TrackValue::moves;
+		auto moved = O::Collect(std::move(inputs));
+		ASSERT_TRUE(moved.Has_Value());
+		EXPECT_EQ(moved.Value().back().v, 3);
+		EXPECT_EQ(TrackValue::copies - copies, 0);
+		EXPECT_EQ(TrackValue::moves - moves, 4);
+
+		std::list<Tracked> failing;
+		failing.push_back(Tracked::Make_Value(1));
+		failing.push_back(Tracked::Make_Error(std::string("bad track")));
+		copies = TrackError::copies;
+		auto failed = O::Collect(std::move(failing));
+		ASSERT_TRUE(failed.Has_Error());
+		EXPECT_EQ(failed.Error().msg, "bad track");
+		EXPECT_EQ(TrackError::copies - copies, 0);
+	}
+	EXPECT_EQ(TrackValue::constructions + TrackValue::copies + TrackValue::moves, TrackValue::destructions);
+	EXPECT_EQ(TrackError::constructions + TrackError::copies + TrackError::moves, TrackError::destructions);
+}
+
+TEST(Expected_Collect, Bounded_Vector_Overflow_Throws)
+{
+	const std::vector<Parsed> inputs = { Parse(1), Parse(2), Parse(3) };
+	O_EXPECT_THROW_VALUE(static_cast<void>(O::Collect<O::Bounded_Vector<int, 2>>(inputs)), O::Bounded_Vector_Exception::NO_MORE_PLACE_TO_EMPLACE);
+}
+
+TEST(Expected_Collect, Collect_All_Reports_Every_Error)
+{
+	const std::vector<Parsed> inputs = { Parse(-1), Parse(1), Parse(200), Parsed(), Parse(-2), Parse(-3) };
+
+	O::Bounded_Vector<Parse_Error, 2> errors;
+	auto all = O::Collect_All<std::vector<int>>(inputs, errors);
+	ASSERT_TRUE(all.Has_Error());
+	EXPECT_EQ(all.Error(), 5u);
+	ASSERT_EQ(errors.Size(), 2u);
+	EXPECT_EQ(errors[0], Parse_Error::NEGATIVE);
+	EXPECT_EQ(errors[1], Parse_Error::TOO_LARGE);
+
+	errors.Clear();
+	const std::vector<Parsed> valid = { Parse(5), Parse(6) };
+	auto values = O::Collect_All<O::Bounded_Vector<int, 2>>(valid, errors);
+	ASSERT_TRUE(values.Has_Value());
+	EXPECT_EQ(values.Value()[1], 6);
+	EXPECT_TRUE(errors.Empty());
+}
@@ -0,0 +1,177 @@
+// expected_coroutine_test.cpp
+#include <gtest/gtest.h>
+
+#include "utils/expected_coroutine.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "expected_utils_test.h"
+
+
+enum class Load_Error : unsigned char { NEGATIVE = 1, TOO_LARGE };
+
+static O::Expected<int, Load_Error> Parse(int x)
+{
+	if (x < 0) return Load_Error::NEGATIVE;
+	return x * 2;
+}
+
+static O::Expected<int, Load_Error> Sum(int a, int b, int& reached)
+{
+	const int x = co_await Parse(a);
+	++reached;
+	const int y = co_await Parse(b);
+	++reached;
+	if (x + y > 100)
+		co_return O::Expected<int, Load_Error>(O::error_tag, Load_Error::TOO_LARGE);
+	co_return x + y;
+}
+
+TEST(Expected_Coroutine, Co_Await_Unwraps_Or_Short_Circuits)
+{
+	int reached = 0;
+	auto ok = Sum(1, 2, reached);
+	ASSERT_TRUE(ok.Has_Value());
+	EXPECT_EQ(ok.Value(), 6);
+	EXPECT_EQ(reached, 2);
+
+	reached = 0;
+	auto failed = Sum(1, -2, reached);
+	ASSERT_TRUE(failed.Has_Error());
+	EXPECT_EQ(failed.Error(), Load_Error::NEGATIVE);
+	EXPECT_EQ(reached, 1);
+
+	reached = 0;
+	auto too_large = Sum(40, 40, reached);
+	ASSERT_TRUE(too_large.Has_Error());
+	EXPECT_EQ(too_large.Error(), Load_Error::TOO_LARGE);
+}
+
+
+static O::Expected<TrackValue, TrackError> Load_Track(int v)
+{
+	if (v < 0) return O::Expected<TrackValue, TrackError>::Make_Error(std::string("bad track"));
+	return O::Expected<TrackValue, TrackError>::Make_Value(v);
+}
+
+static O::Expected<TrackValue, TrackError> Forward_Track(int v)
+{
+	TrackValue track = co_await Load_Track(v);
+	track.v += 1;
+	co_return std::move(track);
+}
+
+TEST(Expected_Coroutine, Payloads_Are_Moved_Not_Copied)
+{
+	TrackValue::Reset();
+	TrackError::Reset();
+	{
+		auto ok = Forward_Track(4);
+		ASSERT_TRUE(ok.Has_Value());
+		EXPECT_EQ(ok.Value().v, 5);
+		// out of the awaited temporary, into the result, and at most once more from the return object to the caller
+		EXPECT_LE(TrackValue::moves, 3);
+		EXPECT_EQ(TrackValue::copies, 0);
+
+		auto failed = Forward_Track(-1);
+		ASSERT_TRUE(failed.Has_Error());
+		EXPECT_EQ(failed.Error().msg, "bad track");
+		EXPECT_LE(TrackError::moves, 2);
+		EXPECT_EQ(TrackError::copies, 0);
+	}
+	EXPECT_EQ(TrackValue::constructions + TrackValue::copies + TrackValue::moves, TrackValue::destructions);
+	EXPECT_EQ(TrackError::constructions + TrackError::copies + TrackError::moves, TrackError::destructions);
+}
+
+static O::Expected<std::string, Load_Error> Load_Name(int x)
+{
+	if (x < 0) return Load_Error::NEGATIVE;
+	return std::string(static_cast<std::size_t>(x), 'n') + " outlives the awaited temporary";
+}
+
+TEST(Expected_Coroutine, Reference_Bound_To_An_Awaited_Temporary_Does_Not_Dangle)
+{
+	auto read = [](int x) -> O::Expected<std::size_t, Load_Error> {
+		auto&& forwarded = co_await Load_Name(x);
+		const auto& kept = co_await Load_Name(x + 1);
+		co_return forwarded.size() * 100 + static_cast<std::size_t>(kept[0] == 'n') + (forwarded[0] == 'n' ? 10 : 0);
+	};
+	EXPECT_EQ(read(2).Value(), 3311u);
+	EXPECT_EQ(read(-1).Error(), Load_Error::NEGATIVE);
+}
+
+TEST(Expected_Coroutine, Co_Await_On_Lvalue_Keeps_The_Source)
+{
+	TrackValue::Reset();
+	const O::Expected<TrackValue, TrackError> source(TrackValue(7));
+	auto read = [&]() -> O::Expected<int, TrackError> {
+		const TrackValue& track = co_await source;
+		co_return track.v;
+	};
+	EXPECT_EQ(read().Value(), 7);
+	EXPECT_EQ(source.Value().v, 7);
+	EXPECT_EQ(TrackValue::copies, 0);
+}
+
+
+static O::Expected<void, Load_Error> Store(std::vector<int>& out, int x)
+{
+	out.push_back(co_await Parse(x));
+}
+
+static O::Expected<const int&, Load_Error> Find(const std::vector<int>& values, int x)
+{
+	const int wanted = co_await Parse(x);
+	for (const int& v : values)
+		if (v == wanted)
+			co_return v;
+	co_return O::Expected<const int&, Load_Error>(O::error_tag, Load_Error::TOO_LARGE);
+}
+
+TEST(Expected_Coroutine, Void_And_Reference_Coroutines)
+{
+	std::vector<int> values;
+	EXPECT_TRUE(Store(values, 1).Has_Value());
+	EXPECT_TRUE(Store(values, 3).Has_Value());
+	auto failed = Store(values, -1);
+	ASSERT_TRUE(failed.Has_Error());
+	EXPECT_EQ(failed.Error(), Load_Error::NEGATIVE);
+	EXPECT_EQ(values, (std::vector<int>{ 2, 6 }));
+
+	auto found = Find(values, 3);
+	ASSERT_TRUE(found.Has_Value());
+	EXPECT_EQ(&found.Value(), &values[1]);
+	EXPECT_EQ(Find(values, 2).Error(), Load_Error::TOO_LARGE);
+	EXPECT_EQ(Find(values, -2).Error(), Load_Error::NEGATIVE);
+}
+
+TEST(Expected_Coroutine, Frames_Are_Recycled)
+{
+	int reached = 0;
+	static_cast<void>(Sum(1, 2, reached));
+	const std::size_t cached = O::Coroutine_Frame_Pool::Cached_Frames();
+	EXPECT_GE(cached, 1u);
+	for (int i = 0; i < 100; ++i)
+		static_cast<void>(Sum(i, i % 3 == 0 ? -1 : i, reached));
+	EXPECT_EQ(O::Coroutine_Frame_Pool::Cached_Frames(), cached);
+}
+
+#if O_UTILS_HAS_EXCEPTIONS
+static O::Expected<int, Load_Error> Throwing(int x)
+{
+	const int v = co_await Parse(x);
+	if (v > 0) throw std::runtime_error("thrown");
+	co_return v;
+}
+
+TEST(Expected_Coroutine, Exceptions_Propagate_And_Release_The_Frame)
+{
+	static_cast<void>(Throwing(0));
+	const std::size_t cached = O::Coroutine_Frame_Pool::Cached_Frames();
+	for (int i = 0; i < 10; ++i)
+		EXPECT_THROW(static_cast<void>(Throwing(1)), std::runtime_error);
+	EXPECT_EQ(O::Coroutine_Frame_Pool::Cached_Frames(), cached);
+}
+#endif
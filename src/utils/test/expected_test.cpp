@@ -3,7 +3,15 @@
 
 #include "include/utils/expected.h"
 
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+
 #include "expected_utils_test.h"
+#include "exception_utils_test.h"
 
 
 TEST(Expected_Test, Default_Constructed_Is_Empty)
@@ -12,8 +20,8 @@ TEST(Expected_Test, Default_Constructed_Is_Empty)
 	EXPECT_FALSE(e.Has_Value());
 	EXPECT_FALSE(e.Has_Error());
 	EXPECT_FALSE(static_cast<bool>(e));
-	EXPECT_THROW(e.Value(), O::bad_expected_access);
-	EXPECT_THROW(e.Error(), O::bad_expected_access);
+	O_EXPECT_THROW(e.Value(), O::bad_expected_access);
+	O_EXPECT_THROW(e.Error(), O::bad_expected_access);
 }
 
 TEST(Expected_Test, Value_Construction_And_Access)
@@ -119,12 +127,12 @@ TEST(Expected_Test, Value_And_Error_RValue_Accessors_Move)
 TEST(Expected_Test, Throws_When_Accessing_Missing_Variant)
 {
 	O::Expected<int, std::string> ev(10);
-	EXPECT_NO_THROW(ev.Value());
-	EXPECT_THROW(ev.Error(), O::bad_expected_access);
+	O_EXPECT_NO_THROW(ev.Value());
+	O_EXPECT_THROW(ev.Error(), O::bad_expected_access);
 
 	O::Expected<int, std::string> ee(std::string("err"));
-	EXPECT_NO_THROW(ee.Error());
-	EXPECT_THROW(ee.Value(), O::bad_expected_access);
+	O_EXPECT_NO_THROW(ee.Error());
+	O_EXPECT_THROW(ee.Value(), O::bad_expected_access);
 }
 
 TEST(Expected_Test, Swap_Between_Value_And_Error_And_Values)
@@ -159,4 +167,397 @@ TEST(Expected_Test, Move_Leaves_Source_None)
 	// moved-from "a" should be empty (Move_From calls other.Destroy())
 	EXPECT_FALSE(a.Has_Value());
 	EXPECT_FALSE(a.Has_Error());
-}
\ No newline at end of file
+}
+
+enum class Test_Error : unsigned char { BAD = 1 };
+
+static_assert(std::is_trivially_copyable_v<O::Expected<double, Test_Error>>);
+static_assert(std::is_trivially_destructible_v<O::Expected<double, Test_Error>>);
+static_assert(std::is_trivially_copyable_v<O::Expected<int*, int>>);
+static_assert(!std::is_trivially_copyable_v<O::Expected<int, std::string>>);
+static_assert(std::is_copy_constructible_v<O::Expected<int, std::string>>);
+static_assert(!std::is_copy_constructible_v<O::Expected<std::unique_ptr<int>, int>>);
+static_assert(std::is_move_constructible_v<O::Expected<std::unique_ptr<int>, int>>);
+
+TEST(Expected_Test, Trivial_Payload_Copies_And_Moves_Bitwise)
+{
+	O::Expected<double, Test_Error> a(2.5);
+	O::Expected<double, Test_Error> b = a;
+	EXPECT_EQ(b.Value(), 2.5);
+	EXPECT_EQ(a.Value(), 2.5);
+
+	O::Expected<double, Test_Error> c(Test_Error::BAD);
+	b = c;
+	EXPECT_TRUE(b.Has_Error());
+	EXPECT_EQ(b.Error(), Test_Error::BAD);
+
+	// defaulted move: the source keeps its content
+	O::Expected<double, Test_Error> d = std::move(a);
+	EXPECT_EQ(d.Value(), 2.5);
+	EXPECT_TRUE(a.Has_Value());
+}
+
+TEST(Expected_Test, Copy_Constructor_And_Copy_Assignment)
+{
+	TrackValue::Reset();
+	TrackError::Reset();
+	{
+		auto a = O::Expected<TrackValue, TrackError>::Make_Value(4);
+		O::Expected<TrackValue, TrackError> b = a;
+		EXPECT_EQ(TrackValue::copies, 1);
+		EXPECT_EQ(a.Value().v, 4);
+		EXPECT_EQ(b.Value().v, 4);
+
+		auto e = O::Expected<TrackValue, TrackError>::Make_Error(std::string("copied"));
+		b = e;
+		EXPECT_TRUE(b.Has_Error());
+		EXPECT_EQ(b.Error().msg, "copied");
+		EXPECT_EQ(e.Error().msg, "copied");
+		EXPECT_EQ(TrackError::copies, 1);
+
+		const auto& self = b;
+		b = self;
+		EXPECT_EQ(b.Error().msg, "copied");
+
+		O::Expected<TrackValue, TrackError> empty;
+		b = empty;
+		EXPECT_FALSE(b.Has_Value());
+		EXPECT_FALSE(b.Has_Error());
+	}
+	EXPECT_EQ(TrackValue::constructions + TrackValue::copies + TrackValue::moves, TrackValue::destructions);
+	EXPECT_EQ(TrackError::constructions + TrackError::copies + TrackError::moves, TrackError::destructions);
+}
+
+
+// bool is constructible from an Expected through its explicit operator bool: copies must still copy
+TEST(Expected_Test, Copy_Of_Bool_Expected_Keeps_The_Error)
+{
+	auto a = O::Expected<bool, Test_Error>::Make_Error(Test_Error::BAD);
+	O::Expected<bool, Test_Error> b = a;
+	ASSERT_TRUE(b.Has_Error());
+	EXPECT_EQ(b.Error(), Test_Error::BAD);
+
+	auto s = O::Expected<bool, std::string>::Make_Error("full");
+	O::Expected<bool, std::string> t = s;
+	ASSERT_TRUE(t.Has_Error());
+	EXPECT_EQ(t.Error(), "full");
+	auto u = O::Expected<bool, std::string>::Make_Value(false);
+	t = u;
+	ASSERT_TRUE(t.Has_Value());
+	EXPECT_FALSE(t.Value());
+
+	// nor does any other Expected become a value or an error of this one
+	static_assert(!std::is_constructible_v<O::Expected<bool, Test_Error>, O::Expected<int, Test_Error>&>);
+}
+
+// An error enum whose high-order byte is never used, declared as a niche
+enum class Lookup_Error : std::uint32_t { NOT_FOUND = 1, AMBIGUOUS = 2 };
+
+template<>
+struct O::Niche_Traits<Lookup_Error>
+{
+	static constexpr bool ENABLED = true;
+	using Tag = std::uint8_t;
+	static constexpr std::size_t TAG_OFFSET = std::endian::native == std::endian::little ? 3 : 0;
+	static constexpr Tag FIRST_SPARE_TAG = 0xFE;
+	static constexpr Tag SECOND_SPARE_TAG = 0xFF;
+};
+
+static_assert(sizeof(O::Expected<int*, Test_Error>) == sizeof(int*));
+static_assert(sizeof(O::Expected<std::uint16_t, Lookup_Error>) == sizeof(Lookup_Error));
+// no niche or no room next to the tag: tagged layout
+static_assert(sizeof(O::Expected<char*, Test_Error>) == 2 * sizeof(char*));
+static_assert(sizeof(O::Expected<double, std::uint64_t>) == 16);
+static_assert(sizeof(O::Expected<double, Test_Error>) == 2 * sizeof(double)); // every double bit pattern is a value
+static_assert(sizeof(O::Expected<std::uint32_t, std::uint8_t>) == 8);
+static_assert(std::is_trivially_copyable_v<O::Expected<int*, Test_Error>>);
+
+template<typename T, typename E>
+static void Check_Niche_States(T value, E error)
+{
+	O::Expected<T, E> e;
+	EXPECT_FALSE(e.Has_Value());
+	EXPECT_FALSE(e.Has_Error());
+
+	e.Emplace_Value(value);
+	ASSERT_TRUE(e.Has_Value());
+	EXPECT_EQ(e.Value(), value);
+
+	e.Emplace_Error(error);
+	ASSERT_TRUE(e.Has_Error());
+	EXPECT_EQ(e.Error(), error);
+
+	O::Expected<T, E> copy = e;
+	ASSERT_TRUE(copy.Has_Error());
+	EXPECT_EQ(copy.Error(), error);
+
+	O::Expected<T, E> other(value);
+	other.Swap(e);
+	ASSERT_TRUE(other.Has_Error());
+	ASSERT_TRUE(e.Has_Value());
+	EXPECT_EQ(e.Value(), value);
+}
+
+TEST(Expected_Test, Niche_Packed_Layouts_Keep_All_States)
+{
+	int x = 3;
+	Check_Niche_States<int*, Test_Error>(&x, Test_Error::BAD);
+	Check_Niche_States<int*, Test_Error>(nullptr, Test_Error::BAD);
+	Check_Niche_States<std::uint16_t, Lookup_Error>(0xFFFF, Lookup_Error::AMBIGUOUS);
+}
+
+TEST(Expected_Test, Every_Floating_Point_Pattern_Is_A_Value)
+{
+	// NaNs of any kind, including signaling ones coming from binary input, are ordinary values
+	for (std::uint64_t bits : { 0xFFF1000000000000ull, 0xFFF2000000000000ull, 0x7FF0000000000001ull, 0xFFF8000000000000ull })
+	{
+		O::Expected<double, Test_Error> e(std::bit_cast<double>(bits));
+		ASSERT_TRUE(e.Has_Value());
+		EXPECT_FALSE(e.Has_Error());
+		EXPECT_EQ(std::bit_cast<std::uint64_t>(e.Value()), bits);
+	}
+	for (std::uint32_t bits : { 0xFF810000u, 0xFF820000u })
+	{
+		O::Expected<float, Test_Error> e(std::bit_cast<float>(bits));
+		ASSERT_TRUE(e.Has_Value());
+		EXPECT_EQ(std::bit_cast<std::uint32_t>(e.Value()), bits);
+	}
+	Check_Niche_States<double, std::uint32_t>(-std::numeric_limits<double>::infinity(), 0xFFFFFFFFu);
+}
+
+
+TEST(Expected_Test, And_Then_And_Transform_Move_Once_Per_Stage)
+{
+	TrackValue::Reset();
+	TrackError::Reset();
+	{
+		O::Expected<TrackValue, TrackError> start(TrackValue(1));
+		TrackValue::Reset();
+
+		auto result = std::move(start)
+			.Transform([](TrackValue&& v) { v.v += 1; return std::move(v); })
+			.And_Then([](TrackValue&& v) { v.v *= 10; return O::Expected<TrackValue, TrackError>(std::move(v)); })
+			.Transform([](TrackValue&& v) { return v.v + 1; });
+
+		static_assert(std::is_same_v<decltype(result), O::Expected<int, TrackError>>);
+		ASSERT_TRUE(result.Has_Value());
+		EXPECT_EQ(result.Value(), 21);
+		EXPECT_EQ(TrackValue::moves, 2);
+		EXPECT_EQ(TrackValue::copies, 0);
+	}
+	EXPECT_EQ(TrackError::constructions, 0);
+}
+
+TEST(Expected_Test, Combinators_Propagate_Error_With_One_Move_Per_Stage)
+{
+	TrackError::Reset();
+	int calls = 0;
+	{
+		auto start = O::Expected<int, TrackError>::Make_Error(std::string("parse"));
+		TrackError::Reset();
+
+		auto result = std::move(start)
+			.Transform([&](int v) { ++calls; return v + 1; })
+			.And_Then([&](int v) { ++calls; return O::Expected<double, TrackError>(v * 0.5); })
+			.Transform([&](double v) { ++calls; return TrackValue(static_cast<int>(v)); });
+
+		ASSERT_TRUE(result.Has_Error());
+		EXPECT_EQ(result.Error().msg, "parse");
+		EXPECT_EQ(TrackError::moves, 3);
+		EXPECT_EQ(TrackError::copies, 0);
+	}
+	EXPECT_EQ(calls, 0);
+}
+
+TEST(Expected_Test, Or_Else_And_Transform_Error)
+{
+	TrackError::Reset();
+	auto recovered = O::Expected<int, TrackError>::Make_Error(std::string("missing"))
+		.Or_Else([](TrackError&& e) { return O::Expected<int, std::string>(O::error_tag, std::move(e.msg)); })
+		.Transform_Error([](std::string&& msg) { return TrackError(msg + "!"); });
+	ASSERT_TRUE(recovered.Has_Error());
+	EXPECT_EQ(recovered.Error().msg, "missing!");
+	EXPECT_EQ(TrackError::moves, 0);
+	EXPECT_EQ(TrackError::copies, 0);
+
+	TrackValue::Reset();
+	auto kept = O::Expected<TrackValue, TrackError>::Make_Value(4)
+		.Or_Else([](TrackError&&) { return O::Expected<TrackValue, int>(0); })
+		.Transform_Error([](int e) { return e + 1; });
+	ASSERT_TRUE(kept.Has_Value());
+	EXPECT_EQ(kept.Value().v, 4);
+	EXPECT_EQ(TrackValue::moves, 2);
+	EXPECT_EQ(TrackValue::copies, 0);
+}
+
+TEST(Expected_Test, Combinators_On_Lvalues_Copy_And_Keep_Source)
+{
+	TrackValue::Reset();
+	const O::Expected<TrackValue, TrackError> source(TrackValue(5));
+	TrackValue::Reset();
+
+	auto doubled = source.Transform([](const TrackValue& v) { return v.v * 2; });
+	EXPECT_EQ(doubled.Value(), 10);
+	EXPECT_EQ(TrackValue::copies, 0);
+
+	auto copied = source.And_Then([](const TrackValue& v) { return O::Expected<TrackValue, TrackError>(v); });
+	EXPECT_EQ(copied.Value().v, 5);
+	EXPECT_EQ(TrackValue::copies, 1);
+	EXPECT_EQ(source.Value().v, 5);
+
+	O::Expected<TrackValue, TrackError> empty;
+	EXPECT_FALSE(empty.Transform([](TrackValue& v) { return v.v; }).Has_Value());
+	EXPECT_FALSE(empty.Or_Else([](TrackError& e) { return O::Expected<TrackValue, int>(static_cast<int>(e.msg.size())); }).Has_Error());
+}
+
+TEST(Expected_Test, Value_Or)
+{
+	O::Expected<int, std::string> good(3);
+	O::Expected<int, std::string> bad(O::error_tag, "bad");
+	EXPECT_EQ(good.Value_Or(7), 3);
+	EXPECT_EQ(bad.Value_Or(7), 7);
+
+	TrackValue::Reset();
+	O::Expected<TrackValue, TrackError> owned(TrackValue(9));
+	TrackValue taken = std::move(owned).Value_Or(0);
+	EXPECT_EQ(taken.v, 9);
+	EXPECT_EQ(TrackValue::copies, 0);
+}
+
+
+static_assert(sizeof(O::Expected<void, Test_Error>) <= 2 * sizeof(Test_Error));
+static_assert(sizeof(O::Expected<void, int*>) == sizeof(int*));
+static_assert(sizeof(O::Expected<const TrackValue&, Test_Error>) == sizeof(TrackValue*));
+static_assert(std::is_trivially_copyable_v<O::Expected<void, Test_Error>>);
+static_assert(std::is_trivially_copyable_v<O::Expected<TrackValue&, Test_Error>>);
+static_assert(!std::is_constructible_v<O::Expected<const int&, Test_Error>, int&&>);
+
+TEST(Expected_Test, Void_Specialization)
+{
+	O::Expected<void, std::string> empty;
+	EXPECT_FALSE(empty.Has_Value());
+	EXPECT_FALSE(empty.Has_Error());
+	O_EXPECT_THROW(empty.Value(), O::bad_expected_access);
+
+	auto done = O::Expected<void, std::string>::Make_Value();
+	EXPECT_TRUE(done.Has_Value());
+	EXPECT_TRUE(static_cast<bool>(done));
+
+	O::Expected<void, std::string> failed(std::string("disk full"));
+	ASSERT_TRUE(failed.Has_Error());
+	EXPECT_EQ(failed.Error(), "disk full");
+	O_EXPECT_THROW(failed.Value(), O::bad_expected_access);
+
+	failed.Swap(done);
+	EXPECT_TRUE(failed.Has_Value());
+	EXPECT_EQ(std::move(done).Error(), "disk full");
+
+	int calls = 0;
+	auto chained = O::Expected<void, std::string>::Make_Value()
+		.Transform([&] { ++calls; })
+		.And_Then([&] { ++calls; return O::Expected<int, std::string>(calls); })
+		.Transform([](int v) { (void)v; });
+	static_assert(std::is_same_v<decltype(chained), O::Expected<void, std::string>>);
+	EXPECT_TRUE(chained.Has_Value());
+	EXPECT_EQ(calls, 2);
+
+	auto recovered = O::Expected<void, std::string>(O::error_tag, "retry")
+		.Transform_Error([](std::string&& msg) { return msg.size(); })
+		.Or_Else([](std::size_t size) { return size == 5 ? O::Expected<void, int>::Make_Value() : O::Expected<void, int>(-1); });
+	EXPECT_TRUE(recovered.Has_Value());
+}
+
+TEST(Expected_Test, Reference_Specialization_Does_Not_Copy)
+{
+	TrackValue table[3] = { TrackValue(1), TrackValue(2), TrackValue(3) };
+	TrackValue::Reset();
+
+	auto lookup = [&](int key) -> O::Expected<TrackValue&, Test_Error>
+	{
+		for (TrackValue& row : table)
+			if (row.v == key)
+				return row;
+		return Test_Error::BAD;
+	};
+
+	O::Expected<TrackValue&, Test_Error> found = lookup(2);
+	ASSERT_TRUE(found.Has_Value());
+	EXPECT_EQ(&found.Value(), &table[1]);
+	found.Value().v = 20;
+	EXPECT_EQ(table[1].v, 20);
+
+	const O::Expected<TrackValue&, Test_Error> copy = found;
+	EXPECT_EQ(&copy.Value(), &table[1]);
+
+	auto missing = lookup(7);
+	ASSERT_TRUE(missing.Has_Error());
+	EXPECT_EQ(missing.Error(), Test_Error::BAD);
+	O_EXPECT_THROW(missing.Value(), O::bad_expected_access);
+	EXPECT_EQ(&missing.Value_Or(table[0]), &table[0]);
+
+	EXPECT_EQ(lookup(3).Transform([](TrackValue& row) { return row.v * 2; }).Value(), 6);
+	EXPECT_EQ(&lookup(7).Or_Else([&](Test_Error) { return O::Expected<TrackValue&, int>(table[2]); }).Value(), &table[2]);
+	EXPECT_TRUE(lookup(1).Transform_Error([](Test_Error) { return 0; }).Has_Value());
+
+	missing.Emplace_Value(table[0]);
+	EXPECT_EQ(&missing.Value(), &table[0]);
+
+	EXPECT_EQ(TrackValue::copies, 0);
+	EXPECT_EQ(TrackValue::moves, 0);
+}
+
+
+// --- Constant evaluation ---
+static constexpr O::Expected<int, Test_Error> Parse_Digit(char c)
+{
+	if (c < '0' || c > '9') return Test_Error::BAD;
+	return c - '0';
+}
+
+static_assert(Parse_Digit('7').Value() == 7);
+static_assert(Parse_Digit('x').Error() == Test_Error::BAD);
+static_assert(Parse_Digit('4').Transform([](int d) { return d * 10; }).Value() == 40);
+static_assert(Parse_Digit('4').And_Then([](int) { return Parse_Digit('x'); }).Has_Error());
+static_assert(Parse_Digit('x').Or_Else([](Test_Error) { return O::Expected<int, Test_Error>(0); }).Value() == 0);
+static_assert(Parse_Digit('x').Transform_Error([](Test_Error) { return 1; }).Error() == 1);
+static_assert(Parse_Digit('x').Value_Or(-1) == -1);
+static_assert(O::Expected<void, Test_Error>::Make_Value().Has_Value());
+
+// Expected<double, E> keeps its tag next to the value (no floating-point niche): always constant-evaluable
+static constexpr O::Expected<double, Test_Error> HALF = 0.5;
+static_assert(HALF.Value() == 0.5);
+static_assert(O::Expected<double, Test_Error>(Test_Error::BAD).Error() == Test_Error::BAD);
+
+#if O_UTILS_CONSTEXPR_NICHE
+// niche-packed forms: the member alive in the union is the state
+static constexpr int PRIME = 7;
+static constexpr O::Expected<const int*, Test_Error> FOUND = &PRIME;
+static constexpr O::Expected<const int*, Test_Error> MISSING = Test_Error::BAD;
+static_assert(*FOUND.Value() == 7 && MISSING.Error() == Test_Error::BAD);
+static_assert(O::Expected<const int&, Test_Error>(PRIME).Transform([](int p) { return p * 2; }).Value() == 14);
+static_assert(!O::Expected<const int*, Test_Error>().Has_Value() && !O::Expected<const int*, Test_Error>().Has_Error());
+#endif
+
+// a lookup table of results built by the compiler, empty entries included
+static constexpr O::Expected<int, Test_Error> DIGITS[] = { Parse_Digit('1'), Parse_Digit('?'), {} };
+static_assert(DIGITS[0].Value() == 1 && DIGITS[1].Has_Error());
+static_assert(!DIGITS[2].Has_Value() && !DIGITS[2].Has_Error());
+
+// non-trivial payloads: construction, copy, move, swap and destruction all run in constant evaluation
+static constexpr std::size_t String_Payloads()
+{
+	O::Expected<std::string, Test_Error> name = std::string("meridian");
+	O::Expected<std::string, Test_Error> moved = std::move(name);
+	O::Expected<std::string, Test_Error> copy(O::error_tag, Test_Error::BAD);
+	copy = moved;
+	copy.Swap(name);
+	return name.Value().size() + moved.Value().size() + std::move(moved).Transform([](std::string&& s) { return s.size(); }).Value();
+}
+static_assert(String_Payloads() == 24);
+
+TEST(Expected, Constexpr_Members_Give_The_Same_Results_At_Run_Time)
+{
+	EXPECT_EQ(Parse_Digit('7').Value(), 7);
+	EXPECT_EQ(DIGITS[1].Error(), Test_Error::BAD);
+	EXPECT_EQ(String_Payloads(), 24u);
+}
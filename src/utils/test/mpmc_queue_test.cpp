@@ -0,0 +1,123 @@
+// mpmc_queue_test.cpp
+#include <gtest/gtest.h>
+
+#include "utils/mpmc_queue.h"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "expected_utils_test.h"
+
+
+/* ------------------------
+   Single thread behaviour
+   ------------------------ */
+TEST(Mpmc_Queue, Empty_And_Full_Are_Errors)
+{
+	O::Mpmc_Queue<int, 2> q;
+	EXPECT_EQ(q.Capacity(), 2u);
+	EXPECT_EQ(q.Try_Pop().Error(), O::Queue_Error::QUEUE_EMPTY);
+	EXPECT_TRUE(q.Try_Push(1));
+	EXPECT_TRUE(q.Try_Push(2));
+	EXPECT_EQ(q.Try_Push(3).Error(), O::Queue_Error::QUEUE_FULL);
+	EXPECT_EQ(q.Size(), 2u);
+}
+
+#if O_UTILS_HAS_EXCEPTIONS
+// Throws when built from a negative value
+struct Checked
+{
+	int v;
+	explicit Checked(int value) : v(value) { if (value < 0) throw std::runtime_error("negative"); }
+};
+
+TEST(Mpmc_Queue, Throwing_Constructor_Does_Not_Claim_A_Slot)
+{
+	O::Mpmc_Queue<Checked, 2> q;
+	EXPECT_THROW(static_cast<void>(q.Try_Emplace(-1)), std::runtime_error);
+	EXPECT_TRUE(q.Empty());
+	EXPECT_TRUE(q.Try_Emplace(1));
+	EXPECT_TRUE(q.Try_Emplace(2));
+	EXPECT_EQ(q.Try_Pop().Value().v, 1);
+	EXPECT_EQ(q.Try_Pop().Value().v, 2);
+	EXPECT_EQ(q.Try_Pop().Error(), O::Queue_Error::QUEUE_EMPTY);
+}
+#endif
+
+TEST(Mpmc_Queue, Fifo_Order_Across_Laps)
+{
+	O::Mpmc_Queue<int, 4> q;
+	for (int lap = 0; lap < 5; ++lap)
+	{
+		for (int i = 0; i < 4; ++i)
+			ASSERT_TRUE(q.Try_Push(lap * 4 + i));
+		for (int i = 0; i < 4; ++i)
+			EXPECT_EQ(q.Try_Pop().Value(), lap * 4 + i);
+	}
+	EXPECT_TRUE(q.Empty());
+}
+
+TEST(Mpmc_Queue, Move_Only_Payload_And_Cleanup)
+{
+	TrackValue::Reset();
+	{
+		O::Mpmc_Queue<std::unique_ptr<TrackValue>, 4> q;
+		q.Try_Emplace(new TrackValue(1));
+		q.Try_Emplace(new TrackValue(2));
+		auto first = q.Try_Pop();
+		ASSERT_TRUE(first.Has_Value());
+		EXPECT_EQ(first.Value()->v, 1);
+	}
+	EXPECT_EQ(TrackValue::constructions, TrackValue::destructions);
+}
+
+/* ------------------------
+   Many producers and consumers
+   ------------------------ */
+TEST(Mpmc_Queue, Fan_Out_Delivers_Every_Element_Once)
+{
+	constexpr int PRODUCERS = 4;
+	constexpr int CONSUMERS = 4;
+	constexpr int PER_PRODUCER = 50000;
+	O::Mpmc_Queue<int, 128> q;
+
+	std::vector<std::atomic<int>> seen(PRODUCERS * PER_PRODUCER);
+	std::atomic<int> consumed{ 0 };
+	std::vector<std::thread> threads;
+
+	for (int p = 0; p < PRODUCERS; ++p)
+		threads.emplace_back([&q, p] {
+			for (int i = 0; i < PER_PRODUCER; )
+			{
+				if (q.Try_Push(p * PER_PRODUCER + i))
+					++i;
+				else
+					std::this_thread::yield();
+			}
+		});
+	for (int c = 0; c < CONSUMERS; ++c)
+		threads.emplace_back([&] {
+			while (consumed.load() < PRODUCERS * PER_PRODUCER)
+			{
+				auto v = q.Try_Pop();
+				if (!v)
+				{
+					std::this_thread::yield();
+					continue;
+				}
+				seen[v.Value()].fetch_add(1);
+				consumed.fetch_add(1);
+			}
+		});
+	for (auto& t : threads)
+		t.join();
+
+	bool each_once = true;
+	for (auto& s : seen)
+		each_once = each_once && (s.load() == 1);
+	EXPECT_TRUE(each_once);
+	EXPECT_TRUE(q.Empty());
+}
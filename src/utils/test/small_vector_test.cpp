@@ -0,0 +1,207 @@
+// small_vector_test.cpp
+#include <gtest/gtest.h>
+
+#include "utils/small_vector.h"
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include "expected_utils_test.h"
+#include "exception_utils_test.h"
+
+
+/* ------------------------
+   Inline storage
+   ------------------------ */
+TEST(Small_Vector, Default_Constructed_Is_Inline_And_Empty)
+{
+	O::Small_Vector<int, 4> v;
+	EXPECT_EQ(v.Size(), 0u);
+	EXPECT_TRUE(v.Empty());
+	EXPECT_TRUE(v.Is_Inline());
+	EXPECT_EQ(v.Capacity(), 4u);
+	EXPECT_EQ(v.Inline_Capacity(), 4u);
+}
+
+TEST(Small_Vector, Stays_Inline_Up_To_N)
+{
+	O::Small_Vector<int, 4> v;
+	for (int i = 0; i < 4; ++i)
+		v.Push_Back(i);
+	EXPECT_TRUE(v.Is_Inline());
+	EXPECT_EQ(v.Size(), 4u);
+	EXPECT_EQ(std::accumulate(v.begin(), v.end(), 0), 6);
+}
+
+/* ------------------------
+   Spill to the heap
+   ------------------------ */
+TEST(Small_Vector, Spills_And_Grows_Geometrically)
+{
+	O::Small_Vector<int, 4> v;
+	for (int i = 0; i < 5; ++i)
+		v.Push_Back(i);
+	EXPECT_FALSE(v.Is_Inline());
+	EXPECT_EQ(v.Capacity(), 8u);
+
+	for (int i = 5; i < 9; ++i)
+		v.Push_Back(i);
+	EXPECT_EQ(v.Capacity(), 16u);
+	EXPECT_EQ(v.Size(), 9u);
+	for (std::size_t i = 0; i < v.Size(); ++i)
+		EXPECT_EQ(v[i], static_cast<int>(i));
+}
+
+TEST(Small_Vector, Push_Back_Of_Own_Element_While_Growing)
+{
+	O::Small_Vector<std::string, 2> v;
+	v.Push_Back("first");
+	v.Push_Back("second");
+	v.Push_Back(v[0]);
+	ASSERT_EQ(v.Size(), 3u);
+	EXPECT_EQ(v[2], "first");
+	EXPECT_EQ(v[0], "first");
+}
+
+TEST(Small_Vector, Reserve_Allocates_Once)
+{
+	O::Small_Vector<int, 2> v;
+	v.Reserve(100);
+	EXPECT_FALSE(v.Is_Inline());
+	EXPECT_EQ(v.Capacity(), 100u);
+	const int* data = v.Data();
+	for (int i = 0; i < 100; ++i)
+		v.Push_Back(i);
+	EXPECT_EQ(v.Data(), data);
+}
+
+/* ------------------------
+   Element access & exceptions
+   ------------------------ */
+TEST(Small_Vector, At_And_Pop_Back_Throw)
+{
+	O::Small_Vector<int, 2> v;
+	O_EXPECT_THROW(v.Pop_Back(), O::Bounded_Vector_Exception);
+	v.Push_Back(1);
+	EXPECT_EQ(v.At(0), 1);
+	O_EXPECT_THROW_VALUE(v.At(3), O::Bounded_Vector_Exception::OUT_OF_RANGE);
+	v.Pop_Back();
+	EXPECT_TRUE(v.Empty());
+}
+
+/* ------------------------
+   Copy and move semantics
+   ------------------------ */
+TEST(Small_Vector, Copy_Inline_And_Heap)
+{
+	O::Small_Vector<std::string, 2> small{ std::string("a") };
+	O::Small_Vector<std::string, 2> small_copy(small);
+	EXPECT_TRUE(small_copy.Is_Inline());
+	EXPECT_EQ(small_copy[0], "a");
+
+	O::Small_Vector<std::string, 2> big{ std::string("a"), std::string("b"), std::string("c") };
+	O::Small_Vector<std::string, 2> big_copy;
+	big_copy = big;
+	EXPECT_FALSE(big_copy.Is_Inline());
+	ASSERT_EQ(big_copy.Size(), 3u);
+	EXPECT_EQ(big_copy[2], "c");
+	EXPECT_NE(big_copy.Data(), big.Data());
+}
+
+TEST(Small_Vector, Move_Steals_Heap_Block)
+{
+	O::Small_Vector<int, 2> a{ 1, 2, 3 };
+	const int* heap = a.Data();
+
+	O::Small_Vector<int, 2> b(std::move(a));
+	EXPECT_EQ(b.Data(), heap);
+	EXPECT_EQ(b.Size(), 3u);
+	EXPECT_EQ(a.Size(), 0u);
+	EXPECT_TRUE(a.Is_Inline());
+
+	O::Small_Vector<int, 2> c{ 9 };
+	c = std::move(b);
+	EXPECT_EQ(c.Data(), heap);
+	EXPECT_EQ(c[2], 3);
+	EXPECT_TRUE(b.Empty());
+}
+
+TEST(Small_Vector, Move_Inline_Leaves_Source_Empty)
+{
+	O::Small_Vector<std::string, 4> a{ std::string("x"), std::string("y") };
+	O::Small_Vector<std::string, 4> b(std::move(a));
+	EXPECT_TRUE(b.Is_Inline());
+	EXPECT_EQ(b[1], "y");
+	EXPECT_EQ(a.Size(), 0u);
+}
+
+TEST(Small_Vector, Every_Construction_Is_Destroyed)
+{
+	TrackValue::Reset();
+	{
+		O::Small_Vector<TrackValue, 2> v;
+		for (int i = 0; i < 10; ++i)
+			v.Emplace_Back(i);
+		O::Small_Vector<TrackValue, 2> copy(v);
+		O::Small_Vector<TrackValue, 2> moved(std::move(copy));
+		EXPECT_EQ(moved[9].v, 9);
+	}
+	EXPECT_EQ(TrackValue::constructions + TrackValue::copies + TrackValue::moves, TrackValue::destructions);
+}
+
+#if O_UTILS_HAS_EXCEPTIONS
+// Copies throw once `copies_left` reaches zero; the move may throw too, so growth has to copy
+struct Throwing_Copy
+{
+	static inline int copies_left = -1;
+	static inline int live = 0;
+	std::string text;
+
+	explicit Throwing_Copy(std::string t) : text(std::move(t)) { ++live; }
+	Throwing_Copy(const Throwing_Copy& other) : text(other.text)
+	{
+		if (copies_left == 0) throw std::runtime_error("copy");
+		--copies_left;
+		++live;
+	}
+	Throwing_Copy(Throwing_Copy&& other) noexcept(false) : text(std::move(other.text)) { ++live; }
+	~Throwing_Copy() { --live; }
+};
+
+static std::size_t Copy_Of(const O::Small_Vector<Throwing_Copy, 2>& v)
+{
+	O::Small_Vector<Throwing_Copy, 2> copy(v);
+	return copy.Size();
+}
+
+TEST(Small_Vector, Throwing_Growth_Leaves_The_Content_Unchanged)
+{
+	{
+		O::Small_Vector<Throwing_Copy, 2> v;
+		v.Emplace_Back(std::string(40, 'a'));
+		v.Emplace_Back(std::string(40, 'b'));
+
+		Throwing_Copy::copies_left = 1;
+		EXPECT_THROW(v.Emplace_Back(std::string(40, 'c')), std::runtime_error);
+		EXPECT_TRUE(v.Is_Inline());
+		ASSERT_EQ(v.Size(), 2u);
+		EXPECT_EQ(v[1].text, std::string(40, 'b'));
+
+		Throwing_Copy::copies_left = 0;
+		EXPECT_THROW(v.Reserve(8), std::runtime_error);
+		EXPECT_EQ(v.Capacity(), 2u);
+		EXPECT_EQ(v[0].text, std::string(40, 'a'));
+
+		Throwing_Copy::copies_left = -1;
+		v.Emplace_Back(std::string(40, 'c'));
+		EXPECT_EQ(v[2].text, std::string(40, 'c'));
+
+		// a copy constructor that fails gives its heap block back
+		Throwing_Copy::copies_left = 2;
+		EXPECT_THROW(Copy_Of(v), std::runtime_error);
+		Throwing_Copy::copies_left = -1;
+	}
+	EXPECT_EQ(Throwing_Copy::live, 0);
+}
+#endif
@@ -0,0 +1,182 @@
+// spsc_queue_test.cpp
+#include <gtest/gtest.h>
+
+#include "utils/spsc_queue.h"
+
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "expected_utils_test.h"
+
+
+/* ------------------------
+   Single thread behaviour
+   ------------------------ */
+TEST(Spsc_Queue, Empty_And_Full_Are_Errors)
+{
+	O::Spsc_Queue<int, 2> q;
+	EXPECT_EQ(q.Capacity(), 2u);
+	EXPECT_TRUE(q.Empty());
+
+	auto empty = q.Try_Pop();
+	ASSERT_TRUE(empty.Has_Error());
+	EXPECT_EQ(empty.Error(), O::Queue_Error::QUEUE_EMPTY);
+
+	EXPECT_TRUE(q.Try_Push(1));
+	EXPECT_TRUE(q.Try_Push(2));
+	auto full = q.Try_Push(3);
+	ASSERT_TRUE(full.Has_Error());
+	EXPECT_EQ(full.Error(), O::Queue_Error::QUEUE_FULL);
+	EXPECT_EQ(q.Size(), 2u);
+}
+
+TEST(Spsc_Queue, Fifo_Order_Across_Wrap)
+{
+	O::Spsc_Queue<int, 4> q;
+	int next_pop = 0;
+	for (int i = 0; i < 20; ++i)
+	{
+		ASSERT_TRUE(q.Try_Push(i));
+		if (i % 2 == 1)
+		{
+			EXPECT_EQ(q.Try_Pop().Value(), next_pop++);
+			EXPECT_EQ(q.Try_Pop().Value(), next_pop++);
+		}
+	}
+	EXPECT_TRUE(q.Empty());
+}
+
+TEST(Spsc_Queue, Move_Only_Payload)
+{
+	O::Spsc_Queue<std::unique_ptr<int>, 4> q;
+	EXPECT_TRUE(q.Try_Emplace(new int(7)));
+	auto popped = q.Try_Pop();
+	ASSERT_TRUE(popped.Has_Value());
+	EXPECT_EQ(*popped.Value(), 7);
+}
+
+TEST(Spsc_Queue, Batch_Push_And_Pop)
+{
+	O::Spsc_Queue<int, 8> q;
+	std::array<int, 6> in{ 0, 1, 2, 3, 4, 5 };
+	EXPECT_EQ(q.Try_Push_N(in).Value(), 6u);
+	// only two slots left
+	EXPECT_EQ(q.Try_Push_N(in).Value(), 2u);
+	auto full = q.Try_Push_N(in);
+	ASSERT_TRUE(full.Has_Error());
+	EXPECT_EQ(full.Error(), O::Queue_Error::QUEUE_FULL);
+
+	std::vector<int> out;
+	EXPECT_EQ(q.Try_Pop_N(std::back_inserter(out), 5).Value(), 5u);
+	EXPECT_EQ(q.Try_Pop_N(std::back_inserter(out), 100).Value(), 3u);
+	EXPECT_EQ(out, (std::vector<int>{ 0, 1, 2, 3, 4, 5, 0, 1 }));
+	EXPECT_EQ(q.Try_Pop_N(std::back_inserter(out), 1).Error(), O::Queue_Error::QUEUE_EMPTY);
+}
+
+static_assert(std::same_as<decltype(std::declval<O::Spsc_Queue<int, 2>&>().Try_Push(1)), O::Expected<void, O::Queue_Error>>);
+
+#if O_UTILS_HAS_EXCEPTIONS
+// Built from an int, throws for 3; its text lives on the heap so that a lost element shows up as a leak
+struct Fragile
+{
+	static inline int live = 0;
+	std::string text;
+
+	Fragile(int v) : text(std::string(32, static_cast<char>('0' + v)))
+	{
+		if (v == 3) throw std::runtime_error("fragile");
+		++live;
+	}
+	Fragile(Fragile&& other) noexcept : text(std::move(other.text)) { ++live; }
+	Fragile& operator=(Fragile&&) = default;
+	~Fragile() { --live; }
+};
+
+// Output slot refusing one of the values
+struct Picky_Sink
+{
+	std::string text;
+	Picky_Sink& operator=(Fragile&& f)
+	{
+		if (f.text[0] == '2') throw std::runtime_error("picky");
+		text = std::move(f.text);
+		return *this;
+	}
+};
+
+TEST(Spsc_Queue, Throwing_Batch_Is_Not_Pushed_Nor_Leaked)
+{
+	{
+		O::Spsc_Queue<Fragile, 8> q;
+		const std::array<int, 5> in{ 0, 1, 2, 3, 4 };
+		EXPECT_THROW(static_cast<void>(q.Try_Push_N(in)), std::runtime_error);
+		EXPECT_TRUE(q.Empty());
+		EXPECT_EQ(Fragile::live, 0);
+
+		// the queue is still usable; a failing pop keeps the element it could not hand out
+		EXPECT_EQ(q.Try_Push_N(std::array<int, 3>{ 0, 1, 2 }).Value(), 3u);
+		std::array<Picky_Sink, 3> out;
+		EXPECT_THROW(static_cast<void>(q.Try_Pop_N(out.data(), 3)), std::runtime_error);
+		EXPECT_EQ(out[1].text[0], '1');
+		ASSERT_EQ(q.Size(), 1u);
+		EXPECT_EQ(q.Try_Pop().Value().text[0], '2');
+	}
+	EXPECT_EQ(Fragile::live, 0);
+}
+#endif
+
+TEST(Spsc_Queue, Destructor_Destroys_Left_Elements)
+{
+	TrackValue::Reset();
+	{
+		O::Spsc_Queue<TrackValue, 4> q;
+		q.Try_Emplace(1);
+		q.Try_Emplace(2);
+		auto popped = q.Try_Pop();
+	}
+	EXPECT_EQ(TrackValue::constructions + TrackValue::copies + TrackValue::moves, TrackValue::destructions);
+}
+
+/* ------------------------
+   Two threads handoff
+   ------------------------ */
+TEST(Spsc_Queue, Producer_Consumer_Threads)
+{
+	constexpr int COUNT = 200000;
+	O::Spsc_Queue<int, 64> q;
+
+	std::thread producer([&q] {
+		for (int i = 0; i < COUNT; )
+		{
+			if (q.Try_Push(i))
+				++i;
+			else
+				std::this_thread::yield();
+		}
+	});
+
+	long long sum = 0;
+	int expected_next = 0;
+	bool in_order = true;
+	while (expected_next < COUNT)
+	{
+		auto v = q.Try_Pop();
+		if (!v)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+		in_order = in_order && (v.Value() == expected_next);
+		sum += v.Value();
+		++expected_next;
+	}
+	producer.join();
+
+	EXPECT_TRUE(in_order);
+	EXPECT_EQ(sum, static_cast<long long>(COUNT) * (COUNT - 1) / 2);
+	EXPECT_TRUE(q.Empty());
+}
@@ -0,0 +1,131 @@
+// zip_parallel_test.cpp
+#include <gtest/gtest.h>
+
+#include "utils/zip_parallel.h"
+#include "utils/exceptions.h"
+
+#include <atomic>
+#include <deque>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+TEST(Worker_Pool, Runs_Every_Task_Once)
+{
+	O::Worker_Pool pool(3);
+	EXPECT_EQ(pool.Concurrency(), 4u);
+
+	std::vector<std::atomic<int>> hits(1000);
+	for (int round = 0; round < 20; ++round)
+		pool.Run(hits.size(), [&](std::size_t i) { hits[i].fetch_add(1, std::memory_order_relaxed); });
+	for (const auto& h : hits)
+		EXPECT_EQ(h.load(), 20);
+
+	// nested jobs run serially on the calling worker
+	std::atomic<int> inner = 0;
+	pool.Run(8, [&](std::size_t) { pool.Run(4, [&](std::size_t) { ++inner; }); });
+	EXPECT_EQ(inner.load(), 32);
+
+	O::Worker_Pool alone(0);
+	int serial = 0;
+	alone.Run(5, [&](std::size_t i) { serial += static_cast<int>(i); });
+	EXPECT_EQ(serial, 10);
+}
+
+#if O_UTILS_HAS_EXCEPTIONS
+TEST(Worker_Pool, Rethrows_The_Lowest_Failing_Task)
+{
+	O::Worker_Pool pool(3);
+	for (int round = 0; round < 20; ++round)
+	{
+		try
+		{
+			pool.Run(10000, [&](std::size_t i) { if (i % 1000 == 999) throw i; });
+			FAIL() << "Expected Run to throw";
+		}
+		catch (std::size_t i)
+		{
+			EXPECT_EQ(i, 999u);
+		}
+	}
+
+	// still usable after a failure
+	std::atomic<int> count = 0;
+	pool.Run(100, [&](std::size_t) { ++count; });
+	EXPECT_EQ(count.load(), 100);
+}
+#endif
+
+TEST(Par, For_Each_Indexed_Covers_Every_Element)
+{
+	O::Worker_Pool pool(3);
+	std::vector<double> v(100003, 0.0);
+	O::Par::For_Each_Indexed(O::Par::Schedule{ .grain = 1000, .pool = &pool }, v, [](double& x, std::size_t i) { x = static_cast<double>(i); });
+	for (std::size_t i = 0; i < v.size(); ++i)
+		ASSERT_EQ(v[i], static_cast<double>(i));
+
+	std::deque<int> d(5000, 1);
+	O::Par::For_Each_Indexed(O::Par::Schedule{ .grain = 64, .pool = &pool }, d, [](int& x, std::size_t i) { x += static_cast<int>(i); });
+	EXPECT_EQ(d[4999], 5000);
+
+	// default schedule on the shared pool
+	std::vector<int> small(10, 1);
+	O::Par::For_Each_Indexed(small, [](int& x, std::size_t) { x *= 2; });
+	EXPECT_EQ(std::accumulate(small.begin(), small.end(), 0), 20);
+}
+
+TEST(Par, For_Each_Zip_Over_Columns)
+{
+	O::Worker_Pool pool(3);
+	const std::size_t n = 50000;
+	std::vector<float> x(n, 1.f), y(n, 2.f), z(n, 3.f), out(n);
+
+	O::Par::For_Each_Zip(O::Par::Schedule{ .grain = 512, .pool = &pool }, out, x, y, z, [](float& o, float a, float b, float c) { o = a + b * c; });
+	EXPECT_TRUE(std::all_of(out.begin(), out.end(), [](float v) { return v == 7.f; }));
+
+	O::Par::For_Each_Zip(out, x, [](float& o, float a) { o -= a; });
+	EXPECT_EQ(out[n - 1], 6.f);
+}
+
+enum class Vertex_Error : unsigned char { NOT_FINITE = 1, OUT_OF_BOUNDS };
+
+TEST(Par, Returns_The_First_Expected_Error)
+{
+	O::Worker_Pool pool(3);
+	std::vector<float> v(100000, 1.f);
+	v[70000] = -1.f;
+	v[123] = 1e9f;
+	v[99999] = -1.f;
+
+	auto check = [](float& x, std::size_t) -> O::Expected<void, Vertex_Error> {
+		if (x < 0.f) return Vertex_Error::NOT_FINITE;
+		if (x > 1e6f) return Vertex_Error::OUT_OF_BOUNDS;
+		x *= 2.f;
+		return O::Expected<void, Vertex_Error>::Make_Value();
+	};
+	auto result = O::Par::For_Each_Indexed(O::Par::Schedule{ .grain = 100, .pool = &pool }, v, check);
+	static_assert(std::is_same_v<decltype(result), O::Expected<void, Vertex_Error>>);
+	ASSERT_TRUE(result.Has_Error());
+	EXPECT_EQ(result.Error(), Vertex_Error::OUT_OF_BOUNDS);
+	EXPECT_EQ(v[0], 2.f);
+
+	std::vector<float> w(1000, 1.f);
+	std::vector<float> valid(1000, 1.f);
+	auto ok = O::Par::For_Each_Zip(O::Par::Schedule{ .grain = 10, .pool = &pool }, w, valid, [&](float& a, float b) { return check(a, static_cast<std::size_t>(b)); });
+	EXPECT_TRUE(ok.Has_Value());
+	EXPECT_EQ(w[999], 2.f);
+}
+
+#if O_UTILS_HAS_EXCEPTIONS
+TEST(Par, Rethrows_Exceptions)
+{
+	O::Worker_Pool pool(3);
+	std::vector<int> v(10000);
+	std::iota(v.begin(), v.end(), 0);
+	EXPECT_THROW(O::Par::For_Each_Indexed(O::Par::Schedule{ .grain = 16, .pool = &pool }, v, [](int x, std::size_t) {
+		if (x == 5000) throw std::out_of_range("vertex");
+	}), std::out_of_range);
+}
+#endif
@@ -5,9 +5,13 @@
 
 #include <vector>
 #include <array>
+#include <deque>
 #include <list>
+#include <span>
 #include <algorithm>
+#include <execution>
 #include <numeric>
+#include <string>
 
 // Test Zip_View iteration and modification through proxy (get0/get1)
 TEST(Zip_Test, Zip_View_Iterates_And_Allows_Modification)
@@ -227,4 +231,262 @@ TEST(Zip_Test, For_Each_Zip_Generic_Iterator_Path_Stops_At_Shortest)
 
 	// a retains original contents for elements not visited
 	EXPECT_EQ(a[3], 8);
-}
\ No newline at end of file
+}
+
+// Zip over more than two ranges: structured bindings on the tuple-like proxy, mixed contiguous / indexed ranges
+TEST(Zip_Test, Zip_Variadic_Binds_Every_Range)
+{
+	std::vector<double> x{ 1, 2, 3 };
+	std::array<double, 3> y{ 10, 20, 30 };
+	std::deque<double> z{ 100, 200, 300 };
+	const std::vector<double> w{ 0.5, 1, 2 };
+
+	auto zip = O::Zip(x, y, z, w);
+	static_assert(std::tuple_size_v<decltype(*zip.begin())> == 4);
+	EXPECT_EQ(zip.size(), 3u);
+
+	std::size_t idx = 0;
+	for (auto&& [xi, yi, zi, wi] : zip)
+	{
+		EXPECT_EQ(&yi, &y[idx]);
+		EXPECT_EQ(&zi, &z[idx]);
+		EXPECT_EQ(&wi, &w[idx]);
+		xi = (xi + yi + zi) * wi;
+		++idx;
+	}
+	EXPECT_EQ(idx, 3u);
+	EXPECT_EQ(x, (std::vector<double>{ 55.5, 222, 666 }));
+
+	auto proxy = *O::Zip(x, y, z).begin();
+	EXPECT_EQ(&proxy.get<2>(), &z[0]);
+	proxy.get<0>() = -1;
+	EXPECT_EQ(x[0], -1);
+}
+
+// For_Each_Zip over more than two ranges: contiguous pointer path and generic iterator path
+TEST(Zip_Test, For_Each_Zip_Variadic)
+{
+	std::vector<float> x{ 1, 2, 3, 4 };
+	std::vector<float> y{ 1, 1, 1, 1 };
+	std::array<float, 4> z{ 2, 2, 2, 2 };
+	std::span<const float> weight(y);
+
+	O::For_Each_Zip(x, y, z, weight, [](float& a, float& b, float& c, const float& d) {
+		a = (a + b) * c * d;
+	});
+	EXPECT_EQ(x, (std::vector<float>{ 4, 6, 8, 10 }));
+
+	std::list<int> shorter{ 1, 2 };
+	std::vector<int> sums;
+	O::For_Each_Zip(x, shorter, z, [&sums](float a, int b, float c) {
+		sums.push_back(static_cast<int>(a) + b + static_cast<int>(c));
+	});
+	EXPECT_EQ(sums, (std::vector<int>{ 7, 10 }));
+}
+
+// The Zip views are random-access, sized, borrowed std::ranges views
+using Zip_Int_String = O::Zip_View<std::vector<int>, std::vector<std::string>>;
+static_assert(std::random_access_iterator<Zip_Int_String::Iterator>);
+static_assert(std::ranges::random_access_range<Zip_Int_String> && std::ranges::sized_range<Zip_Int_String>);
+static_assert(std::ranges::view<Zip_Int_String> && std::ranges::borrowed_range<Zip_Int_String>);
+static_assert(std::sortable<Zip_Int_String::Iterator>);
+static_assert(std::ranges::random_access_range<O::Zip_View<std::deque<int>, const std::vector<double>, std::array<char, 2>>>);
+static_assert(std::ranges::random_access_range<O::Zip_Index_View<std::vector<int>>> && std::ranges::view<O::Zip_Index_View<std::vector<int>>>);
+static_assert(std::ranges::random_access_range<O::Zip_Adjacent_View<std::vector<int>, false>> && std::ranges::borrowed_range<O::Zip_Adjacent_View<std::vector<int>, true>>);
+
+TEST(Zip_Test, Zip_Sorts_Rows_Together)
+{
+	std::vector<int> keys{ 3, 1, 2, 1 };
+	std::vector<std::string> names{ "three", "one-b", "two", "one-a" };
+
+	// lexicographic order of the rows with the default comparison
+	std::ranges::sort(O::Zip(keys, names));
+	EXPECT_EQ(keys, (std::vector<int>{ 1, 1, 2, 3 }));
+	EXPECT_EQ(names, (std::vector<std::string>{ "one-a", "one-b", "two", "three" }));
+
+	// by one column, through a projection and the classic algorithm
+	std::ranges::sort(O::Zip(keys, names), std::ranges::greater{}, [](const auto& row) -> decltype(auto) { return get<1>(row); });
+	EXPECT_EQ(keys, (std::vector<int>{ 2, 3, 1, 1 }));
+
+	auto zip = O::Zip(keys, names);
+	std::stable_sort(zip.begin(), zip.end(), [](const auto& a, const auto& b) { return get<0>(a) < get<0>(b); });
+	EXPECT_EQ(keys, (std::vector<int>{ 1, 1, 2, 3 }));
+	EXPECT_EQ(names, (std::vector<std::string>{ "one-b", "one-a", "two", "three" }));
+
+	// rows convert to and compare with their value type
+	const std::tuple<int, std::string> row = zip[2];
+	EXPECT_EQ(row, std::make_tuple(2, std::string("two")));
+	EXPECT_TRUE(zip[2] == row);
+	EXPECT_TRUE(zip[1] < zip[0] && zip[1] < zip[2]);
+	zip[0] = std::make_tuple(0, std::string("zero"));
+	EXPECT_EQ(names[0], "zero");
+}
+
+TEST(Zip_Test, Zip_Iterators_Are_Random_Access)
+{
+	std::vector<int> a{ 0, 1, 2, 3, 4, 5 };
+	std::deque<int> b{ 0, 10, 20, 30, 40, 50 };
+	auto zip = O::Zip(a, b);
+
+	auto it = zip.begin() + 4;
+	EXPECT_EQ(it - zip.begin(), 4);
+	EXPECT_EQ(it[-1].second, 30);
+	EXPECT_EQ((*--it).first, 3);
+	EXPECT_TRUE(zip.begin() < it && it <= zip.end());
+	EXPECT_EQ(zip.back().second, 50);
+	EXPECT_FALSE(zip.empty());
+
+	// composes with std::views; iterators outlive the temporary view (borrowed range)
+	std::vector<int> sums;
+	for (auto&& [x, y] : O::Zip(a, b) | std::views::reverse | std::views::drop(3))
+		sums.push_back(x + y);
+	EXPECT_EQ(sums, (std::vector<int>{ 22, 11, 0 }));
+
+	auto found = std::ranges::find_if(O::Zip(a, b), [](const auto& row) { return row.second == 20; });
+	EXPECT_EQ(found - zip.begin(), 2);
+
+	auto odd = O::Zip_Index(a) | std::views::filter([](std::tuple<int, std::size_t> e) { return std::get<1>(e) % 2 == 1; });
+	EXPECT_EQ(std::ranges::distance(odd), 3);
+	EXPECT_EQ(O::Zip_Adjacent(a)[4].p_1, 5);
+
+	std::vector<int> empty;
+	EXPECT_EQ(O::Zip_Adjacent(empty).size(), 0u);
+	EXPECT_TRUE(O::Zip_Adjacent(empty).begin() == O::Zip_Adjacent(empty).end());
+}
+
+TEST(Zip_Test, Zip_Runs_Standard_Parallel_Algorithms)
+{
+	std::vector<float> x(1000, 1.f);
+	std::vector<float> y(1000, 2.f);
+	std::vector<float> out(1000);
+
+	auto zip = O::Zip(x, y);
+	std::transform(std::execution::unseq, zip.begin(), zip.end(), out.begin(), [](const auto& row) { return row.first + row.second; });
+	EXPECT_TRUE(std::ranges::all_of(out, [](float v) { return v == 3.f; }));
+
+	std::for_each(std::execution::unseq, zip.begin(), zip.end(), [](auto row) { row.first *= row.second; });
+	EXPECT_EQ(std::reduce(x.begin(), x.end()), 2000.f);
+}
+
+// For_Each_Zip_Batch: whole blocks as fixed-extent spans, the remainder through the scalar tail
+TEST(Zip_Test, For_Each_Zip_Batch_Blocks_And_Tail)
+{
+	std::vector<float> out(19, 0.f);
+	std::vector<float> x(19);
+	const std::array<float, 19> y{};
+	std::iota(x.begin(), x.end(), 0.f);
+
+	int blocks = 0, tails = 0;
+	O::For_Each_Zip_Batch<8>(out, x, y,
+		[&](std::span<float, 8> o, std::span<float, 8> a, std::span<const float, 8> b) {
+			++blocks;
+			// branch-free form of the tail below
+			for (std::size_t j = 0; j < 8; ++j)
+				o[j] = a[j] > 4.f ? a[j] * 2.f : a[j] + b[j];
+		},
+		[&](float& o, float a, float b) {
+			++tails;
+			if (a > 4.f) o = a * 2.f;
+			else o = a + b;
+		});
+
+	EXPECT_EQ(blocks, 2);
+	EXPECT_EQ(tails, 3);
+	for (std::size_t i = 0; i < out.size(); ++i)
+		EXPECT_EQ(out[i], x[i] > 4.f ? x[i] * 2.f : x[i]);
+
+	std::vector<double> empty_a, empty_b;
+	O::For_Each_Zip_Batch<O::SIMD_LANES<double>>(empty_a, empty_b,
+		[&](auto, auto) { ++blocks; }, [&](double&, double&) { ++tails; });
+	EXPECT_EQ(blocks + tails, 5);
+	static_assert(O::SIMD_LANES<float> * sizeof(float) == O::SIMD_BYTES);
+}
+
+TEST(Zip_Test, For_Each_Indexed_Batch_Reports_Block_Start)
+{
+	std::vector<std::size_t> v(10);
+	std::vector<std::size_t> starts;
+	O::For_Each_Indexed_Batch<4>(v,
+		[&](std::span<std::size_t, 4> block, std::size_t first) {
+			starts.push_back(first);
+			for (std::size_t j = 0; j < 4; ++j) block[j] = first + j;
+		},
+		[](std::size_t& e, std::size_t i) { e = 100 + i; });
+
+	EXPECT_EQ(starts, (std::vector<std::size_t>{ 0, 4 }));
+	EXPECT_EQ(v, (std::vector<std::size_t>{ 0, 1, 2, 3, 4, 5, 6, 7, 108, 109 }));
+}
+
+static_assert(std::ranges::random_access_range<O::Zip_Window_View<std::vector<int>, 3, true>> && std::ranges::borrowed_range<O::Zip_Window_View<std::deque<int>, 4, false>>);
+
+TEST(Zip_Test, Zip_Window_Yields_K_Consecutive_Elements)
+{
+	std::vector<int> a{ 1, 2, 3, 4, 5 };
+
+	std::vector<int> sums;
+	for (auto&& [prev, cur, next] : O::Zip_Window<3>(a))
+		sums.push_back(prev + cur + next);
+	EXPECT_EQ(sums, (std::vector<int>{ 6, 9, 12 }));
+
+	// circular: one window per element, the last two wrap around to the front
+	sums.clear();
+	for (auto&& [prev, cur, next] : O::Zip_Window<3, true>(a))
+		sums.push_back(prev * 100 + cur * 10 + next);
+	EXPECT_EQ(sums, (std::vector<int>{ 123, 234, 345, 451, 512 }));
+
+	// elements are references, random access
+	std::deque<int> d{ 0, 10, 20, 30 };
+	auto window = O::Zip_Window<2, true>(d);
+	get<1>(window[3]) = -1;
+	EXPECT_EQ(d[0], -1);
+	EXPECT_EQ(window.size(), 4u);
+	const std::tuple<int, int> pair = window.back();
+	EXPECT_EQ(pair, std::make_tuple(30, -1));
+}
+
+TEST(Zip_Test, Zip_Window_Handles_Short_Ranges)
+{
+	std::vector<int> empty;
+	EXPECT_TRUE(O::Zip_Window<3>(empty).empty());
+	EXPECT_TRUE((O::Zip_Window<3, true>(empty).empty()));
+
+	std::vector<int> two{ 1, 2 };
+	EXPECT_EQ(O::Zip_Window<3>(two).size(), 0u);
+	EXPECT_EQ(O::Zip_Window<2>(two).size(), 1u);
+
+	// windows wider than the range wrap several times
+	std::vector<std::tuple<int, int, int, int, int>> windows;
+	for (auto&& window : O::Zip_Window<5, true>(two))
+		windows.push_back(window);
+	EXPECT_EQ(windows, (std::vector<std::tuple<int, int, int, int, int>>{ { 1, 2, 1, 2, 1 }, { 2, 1, 2, 1, 2 } }));
+}
+
+TEST(Zip_Test, For_Each_Window_Matches_Zip_Window)
+{
+	std::vector<int> a{ 1, 2, 3, 4, 5, 6, 7 };
+	std::deque<int> d(a.begin(), a.end());
+
+	std::vector<int> expected, seen;
+	for (auto&& [p0, p1, p2, p3] : O::Zip_Window<4, true>(a))
+		expected.push_back(p0 * 1000 + p1 * 100 + p2 * 10 + p3);
+
+	O::For_Each_Window<4, true>(a, [&](int p0, int p1, int p2, int p3) { seen.push_back(p0 * 1000 + p1 * 100 + p2 * 10 + p3); });
+	EXPECT_EQ(seen, expected);
+
+	seen.clear();
+	O::For_Each_Window<4, true>(d, [&](int p0, int p1, int p2, int p3) { seen.push_back(p0 * 1000 + p1 * 100 + p2 * 10 + p3); });
+	EXPECT_EQ(seen, expected);
+
+	// non-circular writes through the references and stops at the last full window
+	std::size_t calls = 0;
+	O::For_Each_Window<3>(a, [&](int& prev, int& cur, int& next) { cur = prev + next; ++calls; });
+	EXPECT_EQ(calls, 5u);
+	EXPECT_EQ(a.front(), 1);
+	EXPECT_EQ(a.back(), 7);
+
+	std::vector<int> empty;
+	O::For_Each_Window<3, true>(empty, [&](int, int, int) { ++calls; });
+	std::vector<int> one{ 4 };
+	O::For_Each_Window<3, true>(one, [&](int p0, int p1, int p2) { calls += p0 + p1 + p2; });
+	EXPECT_EQ(calls, 17u);
+}